@@ -0,0 +1,192 @@
+//
+// MIT License
+// Copyright (c) 2025 Alejandro Massó Martínez, Miguel Curros García, Alejandro González Sánchez
+//
+
+#include "AtlasPacker.h"
+
+#include <algorithm>
+#include <numeric>
+#include <SDL3/SDL.h>
+#include <SDL3_image/SDL_image.h>
+#include "EditorError.h"
+
+editor::AtlasPacker::AtlasPacker(int pageSize, int padding) : _pageSize(pageSize), _padding(padding) {
+}
+
+void editor::AtlasPacker::add(std::filesystem::path const& source, int x, int y, int w, int h) {
+    if (w <= 0 || h <= 0 || w + _padding > _pageSize || h + _padding > _pageSize)
+        return;
+    auto [it, inserted] = _regionsByKey.insert({getKey(source, x, y, w, h), _regions.size()});
+    if (inserted)
+        _regions.push_back({source, x, y, w, h, -1, 0, 0});
+}
+
+bool editor::AtlasPacker::pack(std::filesystem::path const& directory, std::string const& textureDirectory) {
+    std::vector<size_t> order(_regions.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::ranges::sort(order, [this](size_t a, size_t b) {
+        if (_regions[a].h != _regions[b].h) return _regions[a].h > _regions[b].h;
+        return _regions[a].w > _regions[b].w;
+    });
+
+    for (size_t index : order) {
+        Region& region = _regions[index];
+        int w = region.w + _padding;
+        int h = region.h + _padding;
+        for (size_t page = 0; page < _pages.size() && region.page < 0; ++page) {
+            if (insert(_pages[page], w, h, region.atlasX, region.atlasY))
+                region.page = static_cast<int>(page);
+        }
+        if (region.page < 0) {
+            _pages.push_back({{0, 0, _pageSize}});
+            insert(_pages.back(), w, h, region.atlasX, region.atlasY);
+            region.page = static_cast<int>(_pages.size()) - 1;
+        }
+    }
+
+    for (size_t page = 0; page < _pages.size(); ++page) {
+        _pageTextures.push_back(textureDirectory + "page" + std::to_string(page) + ".png");
+    }
+    if (!writePages(directory)) {
+        clear();
+        return false;
+    }
+    return true;
+}
+
+bool editor::AtlasPacker::find(std::filesystem::path const& source, int x, int y, int w, int h, std::string& texture, int& atlasX, int& atlasY) const {
+    auto it = _regionsByKey.find(getKey(source, x, y, w, h));
+    if (it == _regionsByKey.end())
+        return false;
+    Region const& region = _regions[it->second];
+    if (region.page < 0 || region.page >= static_cast<int>(_pageTextures.size()))
+        return false;
+    texture = _pageTextures[region.page];
+    atlasX = region.atlasX;
+    atlasY = region.atlasY;
+    return true;
+}
+
+void editor::AtlasPacker::clear() {
+    _regions.clear();
+    _regionsByKey.clear();
+    _pages.clear();
+    _pageTextures.clear();
+}
+
+std::string editor::AtlasPacker::getKey(std::filesystem::path const& source, int x, int y, int w, int h) {
+    return source.lexically_normal().string() + ":" + std::to_string(x) + "," + std::to_string(y) + "," +
+        std::to_string(w) + "," + std::to_string(h);
+}
+
+int editor::AtlasPacker::fit(std::vector<SkylineNode> const& skyline, size_t index, int w, int h) const {
+    if (skyline[index].x + w > _pageSize)
+        return -1;
+    int y = skyline[index].y;
+    int remaining = w;
+    for (size_t i = index; remaining > 0; ++i) {
+        if (i >= skyline.size())
+            return -1;
+        y = std::max(y, skyline[i].y);
+        if (y + h > _pageSize)
+            return -1;
+        remaining -= skyline[i].w;
+    }
+    return y;
+}
+
+bool editor::AtlasPacker::insert(std::vector<SkylineNode>& skyline, int w, int h, int& x, int& y) const {
+    int bestIndex = -1;
+    int bestBottom = _pageSize + 1;
+    int bestWidth = _pageSize + 1;
+    for (size_t i = 0; i < skyline.size(); ++i) {
+        int top = fit(skyline, i, w, h);
+        if (top < 0)
+            continue;
+        if (top + h < bestBottom || (top + h == bestBottom && skyline[i].w < bestWidth)) {
+            bestIndex = static_cast<int>(i);
+            bestBottom = top + h;
+            bestWidth = skyline[i].w;
+            x = skyline[i].x;
+            y = top;
+        }
+    }
+    if (bestIndex < 0)
+        return false;
+
+    skyline.insert(skyline.begin() + bestIndex, {x, y + h, w});
+    for (size_t i = bestIndex + 1; i < skyline.size();) {
+        SkylineNode const& previous = skyline[i - 1];
+        int overlap = previous.x + previous.w - skyline[i].x;
+        if (overlap <= 0)
+            break;
+        skyline[i].x += overlap;
+        skyline[i].w -= overlap;
+        if (skyline[i].w > 0)
+            break;
+        skyline.erase(skyline.begin() + i);
+    }
+    for (size_t i = 0; i + 1 < skyline.size();) {
+        if (skyline[i].y == skyline[i + 1].y) {
+            skyline[i].w += skyline[i + 1].w;
+            skyline.erase(skyline.begin() + i + 1);
+        }
+        else ++i;
+    }
+    return true;
+}
+
+bool editor::AtlasPacker::writePages(std::filesystem::path const& directory) {
+    if (!exists(directory))
+        create_directories(directory);
+
+    std::vector<SDL_Surface*> pages;
+    for (size_t page = 0; page < _pages.size(); ++page) {
+        int width = 0, height = 0;
+        for (Region const& region : _regions) {
+            if (region.page != static_cast<int>(page)) continue;
+            width = std::max(width, region.atlasX + region.w);
+            height = std::max(height, region.atlasY + region.h);
+        }
+        SDL_Surface* surface = SDL_CreateSurface(width, height, SDL_PIXELFORMAT_RGBA32);
+        if (surface == nullptr) {
+            for (SDL_Surface* created : pages) SDL_DestroySurface(created);
+            showWarning("Could not create atlas page: " + std::string(SDL_GetError()));
+            return false;
+        }
+        SDL_FillSurfaceRect(surface, nullptr, 0);
+        pages.push_back(surface);
+    }
+
+    bool result = true;
+    std::unordered_map<std::string, SDL_Surface*> sources;
+    for (Region const& region : _regions) {
+        auto [it, inserted] = sources.insert({region.source.string(), nullptr});
+        if (inserted) {
+            it->second = IMG_Load(region.source.string().c_str());
+            if (it->second != nullptr)
+                SDL_SetSurfaceBlendMode(it->second, SDL_BLENDMODE_NONE);
+        }
+        if (it->second == nullptr) {
+            showWarning("Could not load image for the texture atlas: " + region.source.string());
+            result = false;
+            break;
+        }
+        SDL_Rect source = {region.x, region.y, region.w, region.h};
+        SDL_Rect destination = {region.atlasX, region.atlasY, region.w, region.h};
+        SDL_BlitSurface(it->second, &source, pages[region.page], &destination);
+    }
+    for (auto const& [path, surface] : sources) {
+        if (surface) SDL_DestroySurface(surface);
+    }
+
+    for (size_t page = 0; page < pages.size(); ++page) {
+        if (result && !IMG_SavePNG(pages[page], (directory / ("page" + std::to_string(page) + ".png")).string().c_str())) {
+            showWarning("Could not save atlas page: " + std::string(SDL_GetError()));
+            result = false;
+        }
+        SDL_DestroySurface(pages[page]);
+    }
+    return result;
+}
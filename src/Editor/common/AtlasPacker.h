@@ -0,0 +1,70 @@
+//
+// MIT License
+// Copyright (c) 2025 Alejandro Massó Martínez, Miguel Curros García, Alejandro González Sánchez
+//
+
+#ifndef RPGBAKER_ATLASPACKER_H
+#define RPGBAKER_ATLASPACKER_H
+
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @~english
+ * @brief Packs rectangular regions of source images into a few atlas pages using a skyline bottom-left packer
+ *
+ * @~spanish
+ * @brief Empaqueta regiones rectangulares de imágenes fuente en unas pocas páginas de atlas usando un empaquetador skyline bottom-left
+ */
+namespace editor {
+    class AtlasPacker {
+    public:
+        explicit AtlasPacker(int pageSize = 2048, int padding = 2);
+
+        void add(std::filesystem::path const& source, int x, int y, int w, int h);
+
+        bool pack(std::filesystem::path const& directory, std::string const& textureDirectory);
+
+        bool find(std::filesystem::path const& source, int x, int y, int w, int h, std::string& texture, int& atlasX, int& atlasY) const;
+
+        void clear();
+
+    private:
+        struct SkylineNode {
+            int x;
+            int y;
+            int w;
+        };
+
+        struct Region {
+            std::filesystem::path source;
+            int x;
+            int y;
+            int w;
+            int h;
+            int page;
+            int atlasX;
+            int atlasY;
+        };
+
+        int _pageSize;
+        int _padding;
+        std::vector<Region> _regions;
+        std::unordered_map<std::string, size_t> _regionsByKey;
+        std::vector<std::vector<SkylineNode>> _pages;
+        std::vector<std::string> _pageTextures;
+
+        static std::string getKey(std::filesystem::path const& source, int x, int y, int w, int h);
+
+        int fit(std::vector<SkylineNode> const& skyline, size_t index, int w, int h) const;
+
+        bool insert(std::vector<SkylineNode>& skyline, int w, int h, int& x, int& y) const;
+
+        bool writePages(std::filesystem::path const& directory);
+    };
+}
+
+
+#endif //RPGBAKER_ATLASPACKER_H
@@ -0,0 +1,87 @@
+//
+// MIT License
+// Copyright (c) 2025 Alejandro Massó Martínez, Miguel Curros García, Alejandro González Sánchez
+//
+
+#include "PakWriter.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <Load/PakFormat.h>
+#include "EditorError.h"
+
+void editor::PakWriter::add(std::string const& name, std::filesystem::path const& source) {
+    _files.push_back({name, source});
+}
+
+void editor::PakWriter::addDirectory(std::filesystem::path const& root, std::filesystem::path const& directory) {
+    for (auto const& entry : std::filesystem::recursive_directory_iterator(directory)) {
+        if (entry.is_regular_file())
+            add(relative(entry.path(), root).generic_string(), entry.path());
+    }
+}
+
+bool editor::PakWriter::write(std::filesystem::path const& archive) {
+    std::ranges::sort(_files, {}, &File::name);
+    auto duplicate = std::ranges::adjacent_find(_files, {}, &File::name);
+    if (duplicate != _files.end()) {
+        showError("Duplicated file in pak archive: " + duplicate->name);
+        return false;
+    }
+
+    std::vector<PakEntry> entries(_files.size());
+    std::string names;
+    for (size_t i = 0; i < _files.size(); ++i) {
+        entries[i].nameOffset = static_cast<uint32_t>(names.size());
+        entries[i].nameSize = static_cast<uint32_t>(_files[i].name.size());
+        entries[i].compression = PakCompression::NONE;
+        entries[i].reserved = 0;
+        names += _files[i].name;
+    }
+
+    PakHeader header {};
+    std::memcpy(header.magic, PakMagic, sizeof(PakMagic));
+    header.version = PakVersion;
+    header.entryCount = static_cast<uint32_t>(entries.size());
+    header.namesSize = static_cast<uint32_t>(names.size());
+
+    uint64_t offset = sizeof(PakHeader) + entries.size() * sizeof(PakEntry) + names.size();
+    for (size_t i = 0; i < _files.size(); ++i) {
+        offset = (offset + PakAlignment - 1) / PakAlignment * PakAlignment;
+        entries[i].offset = offset;
+        entries[i].size = std::filesystem::file_size(_files[i].source);
+        entries[i].storedSize = entries[i].size;
+        offset += entries[i].storedSize;
+    }
+
+    std::ofstream output(archive, std::ios::binary | std::ios::trunc);
+    if (!output) {
+        showError("Could not create pak archive " + archive.string());
+        return false;
+    }
+    output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    output.write(reinterpret_cast<const char*>(entries.data()), static_cast<std::streamsize>(entries.size() * sizeof(PakEntry)));
+    output.write(names.data(), static_cast<std::streamsize>(names.size()));
+    std::vector<char> buffer;
+    for (size_t i = 0; i < _files.size(); ++i) {
+        std::vector<char> padding(entries[i].offset - static_cast<uint64_t>(output.tellp()), 0);
+        output.write(padding.data(), static_cast<std::streamsize>(padding.size()));
+        std::ifstream input(_files[i].source, std::ios::binary);
+        buffer.resize(entries[i].size);
+        if (!input.read(buffer.data(), static_cast<std::streamsize>(buffer.size()))) {
+            showError("Could not read " + _files[i].source.string() + " into the pak archive");
+            return false;
+        }
+        output.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    }
+    if (!output) {
+        showError("Could not write pak archive " + archive.string());
+        return false;
+    }
+    return true;
+}
+
+void editor::PakWriter::clear() {
+    _files.clear();
+}
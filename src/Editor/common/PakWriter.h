@@ -0,0 +1,42 @@
+//
+// MIT License
+// Copyright (c) 2025 Alejandro Massó Martínez, Miguel Curros García, Alejandro González Sánchez
+//
+
+#ifndef RPGBAKER_PAKWRITER_H
+#define RPGBAKER_PAKWRITER_H
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+/**
+ * @~english
+ * @brief Writes game files into a single pak archive with a sorted directory and aligned entries, as read by the engine's FileSystem
+ *
+ * @~spanish
+ * @brief Escribe los archivos del juego en un único archivo pak con un directorio ordenado y entradas alineadas, tal y como los lee el FileSystem del motor
+ */
+namespace editor {
+    class PakWriter {
+    public:
+        void add(std::string const& name, std::filesystem::path const& source);
+
+        void addDirectory(std::filesystem::path const& root, std::filesystem::path const& directory);
+
+        bool write(std::filesystem::path const& archive);
+
+        void clear();
+
+    private:
+        struct File {
+            std::string name;
+            std::filesystem::path source;
+        };
+
+        std::vector<File> _files;
+    };
+}
+
+
+#endif //RPGBAKER_PAKWRITER_H
@@ -13,6 +13,7 @@
 #include <regex>
 #include <sol/sol.hpp>
 #include "EditorError.h"
+#include "PakWriter.h"
 #include "resources/Tileset.h"
 #include "resources/Map.h"
 #include "resources/Sprite.h"
@@ -123,6 +124,7 @@ bool editor::Project::build(const std::string &platform, const sol::table& overW
                 std::filesystem::copy_options::overwrite_existing);
         }
         SDL_free(filepath);
+        buildAtlas(platform);
         for (const auto& [key,map] : _maps) {
             map->writeToEngineLua(platform);
         }
@@ -134,6 +136,9 @@ bool editor::Project::build(const std::string &platform, const sol::table& overW
         buildAudioSettings(platform, audio);
         buildSprites(platform);
         buildAnimations(platform);
+        buildBytecode(platform);
+        if (!buildPak(platform))
+            return false;
     } catch (std::filesystem::filesystem_error& e) {
         EditorError::showError_impl(e.what(), "Project",138);
         return false;
@@ -148,7 +153,13 @@ void editor::Project::buildSettings(const std::string& platform) {
     auto& lua = io::LuaManager::GetInstance().getState();
     sol::table config = lua.create_table();
     sol::table memory = lua.create_table();
-    memory["maxSize"] = 1024*1024*1024;
+    uint64_t maxSize = (platform == "Android" ? 384ull : 1024ull) * 1024 * 1024;
+    memory["maxSize"] = maxSize;
+    sol::table budgets = lua.create_table();
+    budgets["textures"] = maxSize / 2;
+    budgets["audio"] = maxSize / 4;
+    budgets["fonts"] = maxSize / 16;
+    memory["budgets"] = budgets;
     config["memory"] = memory;
     config["initScene"] = "data/scenes/overworld.scene.lua";
     config["gameName"] = _gameName;
@@ -311,8 +322,10 @@ bool editor::Project::buildAPK() const {
         std::ifstream file(entry.path(), std::ios::binary);
         std::vector buffer(std::istreambuf_iterator<char>(file), {});
         zip_fileinfo zi = {};
+        // El motor mapea el pak directamente desde el APK, lo que solo es posible si se almacena sin comprimir
+        bool stored = entry.path().extension() == ".pak";
         zipOpenNewFileInZip(zf, zipPath.c_str(), &zi, nullptr, 0, nullptr, 0, nullptr,
-                            Z_DEFLATED, Z_DEFAULT_COMPRESSION);
+                            stored ? 0 : Z_DEFLATED, stored ? Z_NO_COMPRESSION : Z_DEFAULT_COMPRESSION);
         zipWriteInFileInZip(zf, buffer.data(), buffer.size());
         zipCloseFileInZip(zf);
     }
@@ -558,6 +571,10 @@ std::filesystem::path editor::Project::getBuildPath(const std::string &platform)
     return _projectPath / "build" / platform;
 }
 
+const editor::AtlasPacker& editor::Project::getAtlas() const {
+    return _atlas;
+}
+
 void editor::Project::setPlayerLocalVariables(std::unordered_map<std::string, sol::object>* localVariables) {
     _localVariables = localVariables;
 }
@@ -590,6 +607,59 @@ void editor::Project::setGameIcon(std::string const &icon) {
     _gameIcon = icon;
 }
 
+void editor::Project::buildAtlas(std::string const& platform) {
+    _atlas.clear();
+    for (auto const& [spriteName, sprite] : _sprites) {
+        _atlas.add(sprite->getSource(), sprite->getX(), sprite->getY(), sprite->getWidth(), sprite->getHeight());
+    }
+    for (auto const& [tilesetName, tileset] : _tilesets) {
+        _atlas.add(tileset->getSource(), std::abs(tileset->getOffsetX()), std::abs(tileset->getOffsetY()),
+            tileset->getXTiles() * _dimensions[0], tileset->getYTiles() * _dimensions[1]);
+    }
+    _atlas.pack(getBuildPath(platform)/"data"/"atlas", "data/atlas/");
+}
+
+void editor::Project::buildBytecode(std::string const& platform) {
+    // Las ABIs de 32 bits de Android no aceptan bytecode compilado en 64 bits
+    // 32-bit Android ABIs don't accept bytecode compiled on 64 bits
+    if (platform == "Android") return;
+    std::filesystem::path root = getBuildPath(platform);
+    lua_State* L = io::LuaManager::GetInstance().getState().lua_state();
+    for (auto const& entry : std::filesystem::recursive_directory_iterator(root/"data")) {
+        if (!entry.is_regular_file() || entry.path().extension() != ".lua") continue;
+        std::ifstream input(entry.path(), std::ios::binary);
+        std::string source(std::istreambuf_iterator<char>(input), {});
+        input.close();
+        std::string chunkName = "@" + relative(entry.path(), root).generic_string();
+        if (luaL_loadbufferx(L, source.data(), source.size(), chunkName.c_str(), "t") != LUA_OK) {
+            showWarning("Could not precompile " + entry.path().string() + ": " + lua_tostring(L, -1));
+            lua_pop(L, 1);
+            continue;
+        }
+        std::string bytecode;
+        lua_dump(L, [](lua_State*, const void* data, size_t size, void* output) {
+            static_cast<std::string*>(output)->append(static_cast<const char*>(data), size);
+            return 0;
+        }, &bytecode, 1);
+        lua_pop(L, 1);
+        std::ofstream output(entry.path(), std::ios::binary | std::ios::trunc);
+        output.write(bytecode.data(), static_cast<std::streamsize>(bytecode.size()));
+    }
+}
+
+bool editor::Project::buildPak(std::string const& platform) {
+    std::filesystem::path root = getBuildPath(platform);
+    std::filesystem::path archive = root/"game.pak";
+    PakWriter pak;
+    pak.addDirectory(root, root/"data");
+    if (!pak.write(archive))
+        return false;
+    remove_all(root/"data");
+    create_directory(root/"data");
+    std::filesystem::rename(archive, root/"data"/"game.pak");
+    return true;
+}
+
 void editor::Project::buildSprites(std::string const& platform) {
     if (!exists(getBuildPath(platform)/"data"/"sprites/"))
         create_directory(getBuildPath(platform)/"data"/"sprites/");
@@ -12,6 +12,7 @@
 #include <ctime>
 #include <resources/events/conditions/AndCondition.h>
 #include <sol/sol.hpp>
+#include "AtlasPacker.h"
 
 namespace editor::resources {
     class Tileset;
@@ -215,6 +216,8 @@ namespace editor {
 
         std::filesystem::path getBuildPath(const std::string &platform) const;
 
+        const AtlasPacker& getAtlas() const;
+
         void setPlayerLocalVariables(std::unordered_map<std::string, sol::object>* localVariables);
 
         std::unordered_map<std::string, sol::object>* getPlayerLocalVariables() const;
@@ -248,6 +251,8 @@ namespace editor {
 
         int _dimensions[2];
 
+        AtlasPacker _atlas;
+
         void findProject();
 
         void loadProject(const sol::table& project);
@@ -256,6 +261,12 @@ namespace editor {
 
         bool buildAPK() const;
 
+        void buildAtlas(std::string const& platform);
+
+        void buildBytecode(std::string const& platform);
+
+        bool buildPak(std::string const& platform);
+
         void buildSprites(std::string const& platform);
 
         void buildAnimations(std::string const& platform);
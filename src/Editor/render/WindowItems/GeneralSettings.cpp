@@ -256,6 +256,7 @@ sol::table editor::render::tabs::GeneralSettings::buildOverworldScene(sol::table
     sol::table cameraComponent = lua.create_table();
     components = lua.create_table();
     cameraComponent["size"] = sol::as_table<std::array<int,2>>({dimensions[0] * _cameraSize[0], dimensions[1] * _cameraSize[1]});
+    cameraComponent["virtualResolution"] = true;
     components["Camera"] = cameraComponent;
     components["Transform"] = sol::as_table<std::array<int,1>>({0});
     camera["components"] = components;
@@ -5,6 +5,7 @@
 
 #include "Map.h"
 
+#include <algorithm>
 #include <fstream>
 #include <io/LuaManager.h>
 
@@ -279,34 +280,61 @@ void editor::resources::Map::writeChildren(sol::table &children) {
     auto& lua = io::LuaManager::GetInstance().getState();
     Vector2 dimensions = Vector2(_project->getDimensions()[0], _project->getDimensions()[1]);
     Vector2 center = Vector2(_mapWidth/2.0f, _mapHeight/2.0f);
-    std::unordered_set<int> collisions;
-    for(int i = 0; i < _collisions.size(); ++i) {
-        if (_collisions[i]) collisions.insert(i);
-    }
     for (int i = 0; i < _layers; ++i) {
-        for (int j = 0; j < _mapWidth; j++) {
-            for (int k = 0; k < _mapHeight; k++) {
-                Tile* tile = _tiles[i][k * _mapWidth + j];
-                if (tile != nullptr || (collisions.contains(k * _mapWidth + j) && i == _layers-1)) {
-                    sol::table child = lua.create_table();
-                    sol::table components = lua.create_table();
-                    sol::table transform = lua.create_table();
-                    transform["position"] = sol::as_table<std::array<float,2>>((Vector2(j, k) - center) * dimensions);
-                    components["Transform"] = transform;
-                    if (tile != nullptr) {
-                        sol::table sprite = lua.create_table();
-                        sprite["sprite"] = "data/sprites/"+tile->tileset+std::to_string(tile->pos)+".lua";
-                        sprite["layer"] = i;
-                        components["SpriteRenderer"] = sprite;
-                    }
-                    if (auto finder = collisions.find(k * _mapWidth + j); finder != collisions.end()) {
-                        components["MovementObstacle"] = {0};
-                        collisions.erase(finder);
-                    }
-                    child["components"] = components;
-                    children.add(child);
-                }
+        std::vector<std::string> tilesets;
+        std::vector<int> firstIds;
+        std::vector<int> tiles(_mapWidth * _mapHeight, 0);
+        int nextId = 1;
+        for (int j = 0; j < _mapWidth * _mapHeight; ++j) {
+            Tile* tile = _tiles[i][j];
+            if (tile == nullptr)
+                continue;
+            auto finder = std::ranges::find(tilesets, tile->tileset);
+            if (finder == tilesets.end()) {
+                Tileset* tileset = _project->getTileset(tile->tileset);
+                if (tileset == nullptr)
+                    continue;
+                firstIds.push_back(nextId);
+                nextId += static_cast<int>(tileset->getTiles().size());
+                tilesets.push_back(tile->tileset);
+                finder = tilesets.end() - 1;
             }
+            tiles[j] = firstIds[finder - tilesets.begin()] + tile->pos;
+        }
+        if (tilesets.empty())
+            continue;
+
+        for (std::string& tileset : tilesets) {
+            tileset = "data/tilesets/" + tileset + ".lua";
+        }
+        sol::table tilemap = lua.create_table();
+        tilemap["width"] = _mapWidth;
+        tilemap["height"] = _mapHeight;
+        tilemap["tileSize"] = sol::as_table<std::array<float,2>>(dimensions);
+        tilemap["layer"] = i;
+        tilemap["tilesets"] = sol::as_table(tilesets);
+        tilemap["tiles"] = sol::as_table(tiles);
+        sol::table transform = lua.create_table();
+        transform["position"] = sol::as_table<std::array<float,2>>(Vector2(0, 0));
+        sol::table components = lua.create_table();
+        components["Transform"] = transform;
+        components["TilemapRenderer"] = tilemap;
+        sol::table child = lua.create_table();
+        child["components"] = components;
+        children.add(child);
+    }
+    for (int j = 0; j < _mapWidth; j++) {
+        for (int k = 0; k < _mapHeight; k++) {
+            if (!_collisions[k * _mapWidth + j])
+                continue;
+            sol::table child = lua.create_table();
+            sol::table components = lua.create_table();
+            sol::table transform = lua.create_table();
+            transform["position"] = sol::as_table<std::array<float,2>>((Vector2(j, k) - center) * dimensions);
+            components["Transform"] = transform;
+            components["MovementObstacle"] = {0};
+            child["components"] = components;
+            children.add(child);
         }
     }
 }
@@ -100,10 +100,13 @@ void editor::resources::Sprite::writeToLua() {
 void editor::resources::Sprite::writeToEngineLua(const std::string &platform) {
     sol::table spriteTable = io::LuaManager::GetInstance().getState().create_table();
 
-    spriteTable["texture"] = "data/assets/" + _source.lexically_relative(_project->getAssetsPath()).string();
+    std::string texture = "data/assets/" + _source.lexically_relative(_project->getAssetsPath()).string();
+    int x = _x, y = _y;
+    _project->getAtlas().find(_source, _x, _y, _width, _height, texture, x, y);
+    spriteTable["texture"] = texture;
     sol::table rectTable = io::LuaManager::GetInstance().getState().create_table();
-    rectTable["x"] = _x;
-    rectTable["y"] = _y;
+    rectTable["x"] = x;
+    rectTable["y"] = y;
     rectTable["w"] = _width;
     rectTable["h"] = _height;
     spriteTable["rect"] = rectTable;
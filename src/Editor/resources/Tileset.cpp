@@ -102,22 +102,37 @@ void editor::resources::Tileset::writeToLua() {
 
 void editor::resources::Tileset::writeToEngineLua(const std::string &platform) {
     auto& lua = io::LuaManager::GetInstance().getState();
+    std::string texturePath = (std::filesystem::path("data") / "assets" / _source.lexically_relative(_project->getAssetsPath())).string();
+    std::ranges::replace(texturePath, '\\', '/');
+    int const* dimensions = _project->getDimensions();
+    int offsetX = std::abs(_offsetX), offsetY = std::abs(_offsetY);
+    int atlasX = offsetX, atlasY = offsetY;
+    _project->getAtlas().find(_source, offsetX, offsetY, _xTiles * dimensions[0], _yTiles * dimensions[1], texturePath, atlasX, atlasY);
     for (Tile* tile : _tiles) {
         sol::table tileSprite = lua.create_table();
-        std::string texturePath = (std::filesystem::path("data") / "assets" / _source.lexically_relative(_project->getAssetsPath())).string();
-        std::ranges::replace(texturePath, '\\', '/');
         tileSprite["texture"] = texturePath;
         sol::table rect = lua.create_table();
         SDL_Texture* sdlTexture = reinterpret_cast<SDL_Texture*>(tile->texture);
 
-        rect["x"] = sdlTexture->w * tile->rect.Min.x;
-        rect["y"] = sdlTexture->h * tile->rect.Min.y;
-        rect["w"] = _project->getDimensions()[0];
-        rect["h"] = _project->getDimensions()[1];
+        rect["x"] = sdlTexture->w * tile->rect.Min.x - offsetX + atlasX;
+        rect["y"] = sdlTexture->h * tile->rect.Min.y - offsetY + atlasY;
+        rect["w"] = dimensions[0];
+        rect["h"] = dimensions[1];
         tileSprite["rect"] = rect;
         std::string path = (_project->getBuildPath(platform)/ "data" / "sprites"/(_name+std::to_string(tile->pos)+".lua")).string();
         io::LuaManager::GetInstance().writeToFile(tileSprite, path);
     }
+
+    sol::table tileset = lua.create_table();
+    tileset["texture"] = texturePath;
+    tileset["columns"] = _xTiles;
+    tileset["rows"] = _yTiles;
+    tileset["tileWidth"] = dimensions[0];
+    tileset["tileHeight"] = dimensions[1];
+    tileset["offsetX"] = atlasX;
+    tileset["offsetY"] = atlasY;
+    std::string path = (_project->getBuildPath(platform) / "data" / "tilesets" / (_name + ".lua")).string();
+    io::LuaManager::GetInstance().writeToFile(tileset, path);
 }
 
 const std::vector<editor::resources::Tile*> &editor::resources::Tileset::getTiles() const {
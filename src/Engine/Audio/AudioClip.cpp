@@ -10,7 +10,7 @@
 void AudioClip::Update(void* userdata, SDL_AudioStream* stream, int additional_amount, int total_amount) {
     auto* instance = static_cast<AudioClip*>(userdata);
     if (additional_amount > 0) {
-        if (AudioClipData const* audioData = ResourceHandler<AudioClipData>::Instance()->get(instance->_key);
+        if (AudioClipData const* audioData = instance->_streamData;
             instance->_loop && audioData != nullptr) {
             SDL_PutAudioStreamData(stream, audioData->buffer, audioData->bufferLen);
         }
@@ -32,7 +32,8 @@ void AudioClip::reset() {
 
 AudioClip::AudioClip(std::string const& key) :
     _state(STOPPED),
-    _key(key),
+    _data(ResourceHandler<AudioClipData>::Instance()->request(key)),
+    _streamData(nullptr),
     _stream(nullptr),
     _mixer(nullptr),
     _device(0),
@@ -50,8 +51,8 @@ bool AudioClip::play() {
         return false;
     if (!_stream)
         return false;
-    if (auto data = ResourceHandler<AudioClipData>::Instance()->get(_key);
-        data == nullptr || !SDL_PutAudioStreamData(_stream, data->buffer, data->bufferLen))
+    _streamData = _data.get();
+    if (_streamData == nullptr || !SDL_PutAudioStreamData(_stream, _streamData->buffer, _streamData->bufferLen))
         return false;
     if (!resume())
         return false;
@@ -115,11 +116,15 @@ void AudioClip::setLoop(bool loop) {
 
 void AudioClip::changeKey(std::string const& key) {
     auto state = _state;
-    _key = key;
     stop();
+    _streamData = nullptr;
+    _data = ResourceHandler<AudioClipData>::Instance()->request(key);
     SDL_AudioSpec dstSpec;
     SDL_GetAudioDeviceFormat(_device, &dstSpec, NULL);
-    auto data = ResourceHandler<AudioClipData>::Instance()->get(_key);
+    auto data = _data.get();
+    if (data == nullptr)
+        return;
+    _streamData = data;
     if (!_stream) _stream = SDL_CreateAudioStream(data->specifier, &dstSpec);
     else SDL_SetAudioStreamFormat(_stream, data->specifier, &dstSpec);
     SDL_SetAudioStreamGetCallback(_stream, AudioClip::Update, this);
@@ -156,15 +161,16 @@ bool AudioClip::assignDevice(AudioDevice device) {
     if (_mixer && device != _mixer->getDevice())
         return false;
 
-    if (_key.empty()) {
+    if (_data.empty()) {
         _device = device;
         return true;
     }
-    auto data = ResourceHandler<AudioClipData>::Instance()->get(_key);
+    auto data = _data.get();
     if (data == nullptr)
         return false;
 
     pause();
+    _streamData = data;
     _device = device;
     SDL_AudioSpec dstSpec;
     SDL_GetAudioDeviceFormat(_device, &dstSpec, NULL);
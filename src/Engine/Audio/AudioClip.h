@@ -3,10 +3,12 @@
 
 #include <cstdint>
 #include <string>
+#include <Load/ResourceHandle.h>
 
 typedef uint32_t AudioDevice;
 typedef struct SDL_AudioStream AudioStream;
 class AudioMixer;
+class AudioClipData;
 
 /// @~english
 /// @brief Data structure used to manage a single instance of an audio clip
@@ -19,7 +21,8 @@ private:
         PAUSED,
         STOPPED
     } _state;
-    std::string _key;
+    ResourceHandle<AudioClipData> _data;
+    AudioClipData const* _streamData;
     AudioStream* _stream;
     AudioMixer* _mixer;
     AudioDevice _device;
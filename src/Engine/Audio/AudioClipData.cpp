@@ -2,13 +2,8 @@
 
 #include <SDL3/SDL_audio.h>
 #include <SDL3/SDL_stdinc.h>
+#include <Load/FileSystem.h>
 #include <Utils/Error.h>
-#include <SDL3/SDL.h>
-#ifdef __APPLE__
-#define GetCurrentDir strdup(SDL_GetBasePath())
-#else
-#define GetCurrentDir SDL_GetCurrentDirectory()
-#endif
 
 AudioClipData::AudioClipData(std::string const& path) :
     Resource(path),
@@ -21,21 +16,20 @@ AudioClipData::~AudioClipData() {
     unload();
 }
 
-bool AudioClipData::load() {
+void AudioClipData::prepare() {
     specifier = new SDL_AudioSpec();
-#ifdef __APPLE__
-    auto currDir = GetCurrentDir;
-    std::string clippath = currDir + _path;
-    SDL_free(currDir);
-#else
-    std::string clippath = _path;
-#endif
+    SDL_IOStream* file = FileSystem::Open(_path);
+    if (!file || !SDL_LoadWAV_IO(file, true, specifier, &buffer, &bufferLen))
+        _error = SDL_GetError();
+}
 
-    if (!SDL_LoadWAV(clippath.c_str(), specifier, &buffer, &bufferLen)) {
-        Error::ShowError(std::string("Failed to load") + _path, SDL_GetError());
+bool AudioClipData::load() {
+    if (buffer == nullptr) {
+        Error::ShowError(std::string("Failed to load") + _path, _error);
+        unload();
         return false;
     }
-    _size = bufferLen;
+    _size = bufferLen + sizeof(SDL_AudioSpec);
     return true;
 }
 
@@ -44,6 +38,10 @@ void AudioClipData::unload() {
     SDL_free(buffer);
     specifier = nullptr;
     buffer = nullptr;
-    bufferLen = -1;
-    _size = -1;
+    bufferLen = 0;
+    _size = 0;
+}
+
+std::string_view AudioClipData::getBudget() const {
+    return "audio";
 }
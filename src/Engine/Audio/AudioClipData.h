@@ -8,14 +8,18 @@ typedef struct SDL_AudioSpec AudioSpec;
 typedef uint8_t* AudioBuffer;
 
 class AudioClipData final : public Resource {
+private:
+    std::string _error;
 public:
     AudioBuffer buffer;
     uint32_t bufferLen;
     AudioSpec* specifier;
     explicit AudioClipData(std::string const& path);
     ~AudioClipData() override;
+    void prepare() override;
     bool load() override;
     void unload() override;
+    std::string_view getBudget() const override;
 };
 
 #endif //AUDIOCLIPDATA_H
@@ -1,6 +1,7 @@
 #include "AudioMixerData.h"
 
 #include <Load/LuaReader.h>
+#include <Utils/MemorySize.h>
 
 AudioMixerData::AudioMixerData(std::string const& path) :
     Resource(path),
@@ -25,10 +26,15 @@ bool AudioMixerData::load() {
         }
 
     volume = table.get_or<float, std::string, float>("volume", 1.0f);
-    _size = 0;
+    _size = sizeof(AudioMixerData) + MemorySize::Of(name) + MemorySize::Of(output) + MemorySize::Of(inputs);
     return true;
 }
 
 void AudioMixerData::unload() {
     inputs.clear();
+    _size = 0;
+}
+
+std::string_view AudioMixerData::getBudget() const {
+    return "mixers";
 }
@@ -14,6 +14,7 @@ public:
     explicit AudioMixerData(std::string const& path);
     bool load() override;
     void unload() override;
+    std::string_view getBudget() const override;
 };
 
 #endif //AUDIOMIXERDATA_H
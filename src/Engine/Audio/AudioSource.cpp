@@ -16,16 +16,15 @@ AudioSource::~AudioSource() {
 }
 
 bool AudioSource::init() {
-    auto clipKey = _data->getData<std::string>("clip", "");
-    _clip = new AudioClip(clipKey);
-    auto mixerKey = _data->getData<std::string>("mixer", "");
-    if (mixerKey.empty())
+    const Data& data = _data->get<Data>();
+    _clip = new AudioClip(data.clip);
+    if (data.mixer.empty())
         return false;
-    _mixer = AudioManager::Instance()->getMixer(mixerKey);
+    _mixer = AudioManager::Instance()->getMixer(data.mixer);
     _clip->assignMixer(_mixer);
-    _clip->setVolume(_data->getData("volume", 1.0f));
-    _clip->setLoop(_data->getData("loop", false));
-    if (_data->getData("playOnAwake", false))
+    _clip->setVolume(data.volume);
+    _clip->setLoop(data.loop);
+    if (data.playOnAwake)
         play();
     return true;
 }
@@ -98,3 +97,11 @@ void AudioSource::RegisterToLua(sol::state& luaState) {
     type["changeClip"] = &AudioSource::changeClip;
     type["get"] = AudioSource::get;
 }
+
+void AudioSource::DeclareSchema(ComponentSchemaTemplate<Data>& schema) {
+    schema.field("clip", &Data::clip, "")
+        .field("mixer", &Data::mixer, "")
+        .field("volume", &Data::volume, 1.0f)
+        .field("loop", &Data::loop, false)
+        .field("playOnAwake", &Data::playOnAwake, false);
+}
@@ -17,7 +17,15 @@ private:
     AudioMixer* _mixer;
     
 public:
+    struct Data : ComponentFields {
+        std::string clip;
+        std::string mixer;
+        float volume;
+        bool loop;
+        bool playOnAwake;
+    };
     explicit AudioSource(ComponentData const* data);
+    static void DeclareSchema(ComponentSchemaTemplate<Data>& schema);
     ~AudioSource() override;
     bool init() override;
     void onEnable() override;
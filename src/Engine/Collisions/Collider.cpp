@@ -21,8 +21,9 @@ bool Collider::init() {
     _transform = _entity->getComponent<Transform>();
     CollisionManager::Instance()->registerCollider(this);
 
-    _pos = _data->getVector("position");
-    _size = _data->getVector("size");
+    const Data& data = _data->get<Data>();
+    _pos = data.position;
+    _size = data.size;
 
     return true;
 }
@@ -65,3 +66,8 @@ void Collider::RegisterToLua(sol::state& luaState) {
     type["collisionEndedWith"] = &Collider::collisionEndedWith;
     type["get"] = Collider::get;
 }
+
+void Collider::DeclareSchema(ComponentSchemaTemplate<Data>& schema) {
+    schema.field("position", &Data::position)
+        .field("size", &Data::size);
+}
@@ -24,7 +24,12 @@ private:
     std::unordered_set<Collider*> _collisionEnded;
 
 public:
+    struct Data : ComponentFields {
+        Vector2 position;
+        Vector2 size;
+    };
     explicit Collider(ComponentData const* data);
+    static void DeclareSchema(ComponentSchemaTemplate<Data>& schema);
     ~Collider() override;
     bool init() override;
     void onEnable() override;
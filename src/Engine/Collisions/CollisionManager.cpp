@@ -1,5 +1,6 @@
 #include "CollisionManager.h"
 
+#include <algorithm>
 #include <cassert>
 #include <SDL3/SDL_rect.h>
 
@@ -27,7 +28,8 @@ void CollisionManager::updateCollisions(Collider* collider, Collider* collider2)
         handleCollisionEnd(collider, collider2);
 }
 
-CollisionManager::CollisionManager() = default;
+CollisionManager::CollisionManager() : _batching(false) {
+}
 
 CollisionManager::~CollisionManager() {
     _colliders.clear();
@@ -50,18 +52,36 @@ void CollisionManager::Shutdown() {
 
 void CollisionManager::fixedUpdate() {
     for (auto& collider : _colliders) {
-        collider->_justCollided.clear();
-        collider->_collisionEnded.clear();
         for (auto& collider2 : _colliders) {
             updateCollisions(collider, collider2);
         }
     }
 }
 
+void CollisionManager::clearCollisionEvents() {
+    for (auto& collider : _colliders) {
+        collider->_justCollided.clear();
+        collider->_collisionEnded.clear();
+    }
+}
+
 void CollisionManager::registerCollider(Collider* collider) {
-    _colliders.insert(collider);
+    if (_batching) _pendingRegistrations.push_back(collider);
+    else _colliders.insert(collider);
 }
 
 void CollisionManager::unregisterCollider(Collider* collider) {
+    std::erase(_pendingRegistrations, collider);
     _colliders.erase(collider);
 }
+
+void CollisionManager::beginBatch() {
+    _batching = true;
+}
+
+void CollisionManager::endBatch() {
+    _batching = false;
+    _colliders.reserve(_colliders.size() + _pendingRegistrations.size());
+    _colliders.insert(_pendingRegistrations.begin(), _pendingRegistrations.end());
+    _pendingRegistrations.clear();
+}
@@ -2,10 +2,13 @@
 #define COLLISIONMANAGER_H
 
 #include "Collider.h"
+#include <vector>
 
 class CollisionManager {
 private:
     std::unordered_set<Collider*> _colliders;
+    std::vector<Collider*> _pendingRegistrations;
+    bool _batching;
 
     static CollisionManager* _instance;
 
@@ -90,6 +93,14 @@ public:
     /// @brief Actualización del sistema de colisiones. Actualiza el estado de colisión de cada \c Collider registrado.
     void fixedUpdate();
 
+    /// @~english
+    /// @brief Clears the collisions started and ended registered by every \c Collider .
+    /// @remark Called once per frame so the events of every fixed step in that frame are seen exactly once by the updates.
+    /// @~spanish
+    /// @brief Limpia las colisiones empezadas y terminadas registradas por cada \c Collider .
+    /// @remark Se llama una vez por fotograma para que los eventos de todos los pasos fijos de ese fotograma se vean exactamente una vez en los updates.
+    void clearCollisionEvents();
+
     /// @~english
     /// @brief Adds a \c Collider to be updated by the collision system.
     /// @param collider Pointer to the \c Collider to register.
@@ -105,6 +116,18 @@ public:
     /// @brief Elimina un \c Collider de ser actualizado por el sistema de colisiones.
     /// @param collider Puntero al \c Collider a desregistrar.
     void unregisterCollider(Collider* collider);
+
+    /// @~english
+    /// @brief Starts recording collider registrations instead of applying them right away.
+    /// @~spanish
+    /// @brief Empieza a grabar los registros de colliders en lugar de aplicarlos inmediatamente.
+    void beginBatch();
+
+    /// @~english
+    /// @brief Applies, in order, every collider registration recorded since \c beginBatch .
+    /// @~spanish
+    /// @brief Aplica, en orden, todos los registros de colliders grabados desde \c beginBatch .
+    void endBatch();
 };
 
 #endif //COLLISIONMANAGER_H
@@ -1,8 +1,9 @@
 #include "Component.h"
 #include "ComponentData.h"
+#include "ComponentSchema.h"
 #include "Entity.h"
 
-Component::Component(ComponentData const* data) : _enabled(false) ,_entity(nullptr),  _scene(nullptr), _game(nullptr), _data(data) {
+Component::Component(ComponentData const* data) : _updateIndex(0), _fixedUpdateIndex(0), _enabled(false) ,_entity(nullptr),  _scene(nullptr), _game(nullptr), _data(data) {
 }
 
 void Component::setContext(Entity *entity, Scene *scene, Game *game) {
@@ -19,6 +20,14 @@ int Component::getOrder() const{
     return -1;
 }
 
+bool Component::overridesUpdate() const {
+    return false;
+}
+
+bool Component::overridesFixedUpdate() const {
+    return false;
+}
+
 bool Component::update() {
     return true;
 }
@@ -34,6 +43,9 @@ void Component::onEnable() {
 void Component::onDisable() {
 }
 
+void Component::onTransformChanged() {
+}
+
 bool Component::isEnabled() const {
     return _enabled;
 }
@@ -45,11 +57,12 @@ bool Component::isEntityActive() const {
 void Component::setEnabled(const bool enabled) {
     if (_enabled != enabled) {
         _enabled = enabled;
+        if (!isEntityActive()) return;
         if (_enabled) onEnable();
         else onDisable();
     }
 }
 
 void Component::initEnable() {
-    setEnabled(_data->getData("enabled", true));
+    setEnabled(_data->get<ComponentFields>().enabled);
 }
@@ -1,12 +1,20 @@
 #ifndef COMPONENT_H
 #define COMPONENT_H
+#include <cstddef>
 
 class Entity;
 class Scene;
 class Game;
 class ComponentData;
+struct ComponentFields;
+template<typename Data>
+class ComponentSchemaTemplate;
 
 class Component {
+private:
+    size_t _updateIndex;
+    size_t _fixedUpdateIndex;
+    friend class Scene;
 protected:
     bool _enabled;
     Entity* _entity;
@@ -14,19 +22,26 @@ protected:
     Game* _game;
     ComponentData const* _data;
 public:
+    using Data = ComponentFields;
     Component(ComponentData const* data);
     virtual ~Component() = default;
     void setContext(Entity* entity, Scene* scene, Game* game);
     virtual bool init();
     virtual int getOrder() const;
+    virtual bool overridesUpdate() const;
+    virtual bool overridesFixedUpdate() const;
     virtual bool update();
     virtual bool fixedUpdate();
     virtual void onEnable();
     virtual void onDisable();
+    virtual void onTransformChanged();
     bool isEnabled() const;
     bool isEntityActive() const;
     void setEnabled(bool enabled);
     void initEnable();
+    template<typename D>
+    static void DeclareSchema(ComponentSchemaTemplate<D>& schema) {
+    }
 };
 
 #endif //COMPONENT_H
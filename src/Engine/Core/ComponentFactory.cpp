@@ -8,6 +8,7 @@
 #include <Render/SpriteRenderer.h>
 #include <Render/Camera.h>
 #include <Render/Text.h>
+#include <Render/TilemapRenderer.h>
 #include <Input/Button.h>
 #include <Gameplay/Events/EventHandler.h>
 #include <Gameplay/Movement/MovementManager.h>
@@ -28,6 +29,7 @@ ComponentFactory::ComponentFactory() :
     registerComponent<SpriteRenderer>();
     registerComponent<Camera>();
     registerComponent<Text>();
+    registerComponent<TilemapRenderer>();
     registerComponent<Button>();
     registerComponent<AudioSource>();
     registerComponent<Collider>();
@@ -42,9 +44,9 @@ ComponentFactory::ComponentFactory() :
     registerComponent<MapComponent>();
 }
 
-Component* ComponentFactory::createComponent(ComponentData const* data) {
+Component* ComponentFactory::createComponent(ComponentData const* data, Scene* scene) {
     if (auto finder = _factory.find(data->getId()); finder != _factory.end()) {
-        return finder->second(data);
+        return finder->second(data, scene);
     }
     Error::ShowError("No se encontro el componente " + data->getId(), "Todos los componentes deben delcararse con el metodo RegisterComponent de Component Factory");
     return nullptr;
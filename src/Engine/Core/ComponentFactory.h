@@ -4,22 +4,26 @@
 #include <functional>
 #include <string>
 
+#include "Scene.h"
+#include "ComponentSchema.h"
+
 class Component;
 class ComponentData;
 class ComponentFactory {
     private:
-    std::unordered_map<std::string, std::function<Component*(ComponentData const*)>> _factory;
+    std::unordered_map<std::string, std::function<Component*(ComponentData const*, Scene*)>> _factory;
     int _numComponents;
     public:
     ComponentFactory();
-    Component* createComponent(ComponentData const* data);
+    Component* createComponent(ComponentData const* data, Scene* scene);
     int getOrder(const std::string &name);
     template<typename ComponentType>
     void registerComponent() {
-        if (_factory.insert({ComponentType::id, [] (ComponentData const* data) -> Component* {
-            return new ComponentType(data);
+        if (_factory.insert({ComponentType::id, [] (ComponentData const* data, Scene* scene) -> Component* {
+            return scene->getPool<ComponentType>()->create(data);
         }}).second) {
             ComponentType::order = _numComponents++;
+            ComponentSchema::Register(ComponentType::id, ComponentType::CreateSchema());
         }
     }
 };
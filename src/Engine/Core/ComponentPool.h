@@ -0,0 +1,52 @@
+#ifndef COMPONENTPOOL_H
+#define COMPONENTPOOL_H
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <vector>
+#include "Component.h"
+
+class BaseComponentPool {
+public:
+    virtual ~BaseComponentPool() = default;
+    virtual void release(Component* component) = 0;
+};
+
+template<typename ComponentType>
+class ComponentPool final : public BaseComponentPool {
+private:
+    struct alignas(ComponentType) Storage {
+        std::byte bytes[sizeof(ComponentType)];
+    };
+    static constexpr size_t CHUNK_SIZE = 64;
+    std::vector<std::unique_ptr<Storage[]>> _chunks;
+    std::vector<Storage*> _free;
+
+    void grow() {
+        auto& chunk = _chunks.emplace_back(std::make_unique<Storage[]>(CHUNK_SIZE));
+        for (size_t i = CHUNK_SIZE; i-- > 0;) {
+            _free.push_back(&chunk[i]);
+        }
+    }
+public:
+    ComponentPool() = default;
+    ComponentPool(const ComponentPool&) = delete;
+    ComponentPool& operator=(const ComponentPool&) = delete;
+
+    ComponentType* create(ComponentData const* data) {
+        if (_free.empty()) {
+            grow();
+        }
+        Storage* storage = _free.back();
+        _free.pop_back();
+        return new (storage) ComponentType(data);
+    }
+
+    void release(Component* component) override {
+        auto* typed = static_cast<ComponentType*>(component);
+        typed->~ComponentType();
+        _free.push_back(reinterpret_cast<Storage*>(typed));
+    }
+};
+
+#endif //COMPONENTPOOL_H
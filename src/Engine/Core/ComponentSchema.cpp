@@ -0,0 +1,43 @@
+#include "ComponentSchema.h"
+
+std::unordered_map<std::string, std::unique_ptr<ComponentSchema>> ComponentSchema::_schemas;
+
+Vector2 ComponentSchema::ReadField(sol::table const& table, std::string const& key, Vector2 const& defaultValue) {
+    sol::optional<sol::table> vector = table[key];
+    if (!vector || vector->size() != 2) {
+        return defaultValue;
+    }
+    sol::optional<float> x = (*vector)[1];
+    sol::optional<float> y = (*vector)[2];
+    if (!x || !y) {
+        return defaultValue;
+    }
+    return Vector2(*x, *y);
+}
+
+Symbol ComponentSchema::ReadField(sol::table const& table, std::string const& key, Symbol const& defaultValue) {
+    return table.get_or<std::string>(key, defaultValue.str());
+}
+
+std::unordered_set<std::string> ComponentSchema::ReadField(sol::table const& table, std::string const& key, std::unordered_set<std::string> const& defaultValue) {
+    sol::optional<sol::table> set = table[key];
+    if (!set) {
+        return defaultValue;
+    }
+    std::unordered_set<std::string> result;
+    for (auto& [first, second] : *set) {
+        result.insert(second.as<std::string>());
+    }
+    return result;
+}
+
+void ComponentSchema::Register(std::string const& id, std::unique_ptr<ComponentSchema> schema) {
+    _schemas.insert({id, std::move(schema)});
+}
+
+ComponentSchema const* ComponentSchema::Get(std::string const& id) {
+    if (auto finder = _schemas.find(id); finder != _schemas.end()) {
+        return finder->second.get();
+    }
+    return nullptr;
+}
@@ -0,0 +1,95 @@
+#ifndef COMPONENTSCHEMA_H
+#define COMPONENTSCHEMA_H
+#include <Utils/MemorySize.h>
+#include <Utils/Symbol.h>
+#include <Utils/Vector2.h>
+#include <sol/sol.hpp>
+#include <array>
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+struct ComponentFields {
+    bool enabled = true;
+    size_t memorySize = 0;
+    virtual ~ComponentFields() = default;
+};
+
+class ComponentSchema {
+private:
+    static std::unordered_map<std::string, std::unique_ptr<ComponentSchema>> _schemas;
+protected:
+    template<typename T>
+    static T ReadField(sol::table const& table, std::string const& key, T const& defaultValue) {
+        return table.get_or(key, defaultValue);
+    }
+    template<typename T, size_t N>
+    static std::array<T, N> ReadField(sol::table const& table, std::string const& key, std::array<T, N> const& defaultValue) {
+        sol::optional<sol::table> array = table[key];
+        if (!array) {
+            return defaultValue;
+        }
+        std::array<T, N> result;
+        for (size_t i = 0; i < N; ++i) {
+            sol::optional<T> value = (*array)[i + 1];
+            result[i] = value.value_or(defaultValue[i]);
+        }
+        return result;
+    }
+    template<typename T>
+    static std::vector<T> ReadField(sol::table const& table, std::string const& key, std::vector<T> const& defaultValue) {
+        sol::optional<sol::table> array = table[key];
+        if (!array) {
+            return defaultValue;
+        }
+        std::vector<T> result;
+        result.reserve(array->size());
+        for (size_t i = 1; i <= array->size(); ++i) {
+            sol::optional<T> value = (*array)[i];
+            result.push_back(value.value_or(T{}));
+        }
+        return result;
+    }
+    static Vector2 ReadField(sol::table const& table, std::string const& key, Vector2 const& defaultValue);
+    static Symbol ReadField(sol::table const& table, std::string const& key, Symbol const& defaultValue);
+    static std::unordered_set<std::string> ReadField(sol::table const& table, std::string const& key, std::unordered_set<std::string> const& defaultValue);
+public:
+    virtual ~ComponentSchema() = default;
+    virtual std::shared_ptr<const ComponentFields> compile(sol::table const& table) const = 0;
+    static void Register(std::string const& id, std::unique_ptr<ComponentSchema> schema);
+    static ComponentSchema const* Get(std::string const& id);
+};
+
+template<typename Data>
+class ComponentSchemaTemplate : public ComponentSchema {
+private:
+    std::vector<std::function<void(Data&, sol::table const&)>> _readers;
+public:
+    template<typename T, typename Owner> requires std::is_base_of_v<Owner, Data>
+    ComponentSchemaTemplate& field(std::string const& key, T Owner::* member, std::type_identity_t<T> const& defaultValue = {}) {
+        _readers.push_back([key, member, defaultValue](Data& data, sol::table const& table) {
+            data.*member = ReadField(table, key, defaultValue);
+            data.memorySize += MemorySize::Of(data.*member);
+        });
+        return *this;
+    }
+    ComponentSchemaTemplate& read(std::function<void(Data&, sol::table const&)> reader) {
+        _readers.push_back(std::move(reader));
+        return *this;
+    }
+    std::shared_ptr<const ComponentFields> compile(sol::table const& table) const override {
+        std::shared_ptr<Data> data = std::make_shared<Data>();
+        data->enabled = ReadField(table, "enabled", true);
+        data->memorySize = sizeof(Data);
+        for (auto const& reader : _readers) {
+            reader(*data, table);
+        }
+        return data;
+    }
+};
+
+#endif //COMPONENTSCHEMA_H
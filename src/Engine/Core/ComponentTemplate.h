@@ -1,8 +1,10 @@
 #ifndef COMPONENTTEMPLATE_H
 #define COMPONENTTEMPLATE_H
 #include "Component.h"
+#include "ComponentSchema.h"
 #include <Utils/string_literal.h>
 #include "Entity.h"
+#include <type_traits>
 
 #define ComponentDerived(ClassName, ComponentBase) \
 ClassName : public ComponentTemplate<ClassName, #ClassName, ComponentBase> \
@@ -22,7 +24,24 @@ public:
     static inline int order = -1;
     static constexpr const char* id = componentName.value;
     int getOrder() const override { return order; }
-    static NewComponent* get(Entity* entity) {
+    static constexpr bool HasUpdate() {
+        return !std::is_same_v<decltype(&NewComponent::update), bool (Component::*)()>;
+    }
+    static constexpr bool HasFixedUpdate() {
+        return !std::is_same_v<decltype(&NewComponent::fixedUpdate), bool (Component::*)()>;
+    }
+    bool overridesUpdate() const override { return HasUpdate(); }
+    bool overridesFixedUpdate() const override { return HasFixedUpdate(); }
+    static std::unique_ptr<ComponentSchema> CreateSchema() {
+        auto schema = std::make_unique<ComponentSchemaTemplate<typename NewComponent::Data>>();
+        NewComponent::DeclareSchema(*schema);
+        return schema;
+    }
+    static NewComponent* get(const EntityHandle& handle) {
+        Entity* entity = handle.get();
+        if (entity == nullptr) {
+            return nullptr;
+        }
         return entity->getComponent<NewComponent>();
     }
 
@@ -1,14 +1,18 @@
 #include "Entity.h"
 
+#include <algorithm>
+
 #include <sol/state.hpp>
 
 #include "Component.h"
+#include "Scene.h"
+#include <Render/Transform.h>
 
-Entity::Entity(): _parent(nullptr), _active(false), _alive(true) {
+Entity::Entity(): _parent(nullptr), _active(false), _effectiveActive(false), _alive(true) {
 }
 
 bool Entity::init() {
-     for (auto [id,component] : _components) {
+     for (Component* component : _components) {
           if (component->init()) {
               component->initEnable();
           }
@@ -24,58 +28,32 @@ bool Entity::init() {
      return true;
 }
 
-bool Entity::update() {
-     for (auto [id,component] : _components) {
-          if (component->isEnabled() && !component->update()) {
-               return false;
-          }
-     }
-     for (Entity* child : _children) {
-          if (child->isActive() && !child->update()) {
-               return false;
-          }
-     }
-     return true;
-}
-
-bool Entity::fixedUpdate() {
-     for (auto [id,component] : _components) {
-          if (component->isEnabled() && !component->fixedUpdate()) {
-               return false;
-          }
-     }
-     for (Entity* child : _children) {
-          if (!child->fixedUpdate()) {
-               return false;
-          }
-     }
-     return true;
-}
-
 bool Entity::isActive() const {
-     return _active && (_parent == nullptr || _parent->isActive());
+     return _effectiveActive;
 }
 
 void Entity::setActive(const bool active) {
      if (active != _active) {
           _active = active;
-          for (auto [id,component] : _components) {
-               if (component->isEnabled()) {
-                    if(active) component->onEnable();
-                    else component->onDisable();
-               }
-          }
-          for (Entity* child : _children) {
-               if (child->isActive()) {
-                    for (auto [id,component] : child->_components) {
-                         if (component->isEnabled()) {
-                              if(active) component->onEnable();
-                              else component->onDisable();
-                         }
-                    }
-               }
+          refreshActive();
+     }
+}
+
+void Entity::refreshActive() {
+     const bool effectiveActive = _active && (_parent == nullptr || _parent->_effectiveActive);
+     if (effectiveActive == _effectiveActive) {
+          return;
+     }
+     _effectiveActive = effectiveActive;
+     for (Component* component : _components) {
+          if (component->isEnabled()) {
+               if (effectiveActive) component->onEnable();
+               else component->onDisable();
           }
      }
+     for (Entity* child : _children) {
+          child->refreshActive();
+     }
 }
 
 bool Entity::isAlive() const {
@@ -88,35 +66,75 @@ void Entity::destroy() {
 }
 
 bool Entity::addChild(Entity* child) {
-     if (_children.insert(child).second) {
-          child->setParent(this);
-          return true;
+     if (std::ranges::find(_children, child) != _children.end()) {
+          return false;
      }
-     return false;
+     _children.push_back(child);
+     child->setParent(this);
+     return true;
 }
 
 void Entity::removeChild(Entity *child) {
-     _children.erase(child);
+     std::erase(_children, child);
+}
+
+const std::vector<Entity*>& Entity::getChildren() const {
+     return _children;
 }
 
 void Entity::setParent(Entity* parent) {
      _parent = parent;
+     refreshActive();
+     if (Transform* transform = getComponent<Transform>()) {
+          transform->markDirty();
+     }
 }
 
 Entity * Entity::getParent() const {
      return _parent;
 }
 
+void Entity::setHandle(const EntityHandle& handle) {
+     _handle = handle;
+}
+
+const EntityHandle& Entity::getHandle() const {
+     return _handle;
+}
+
 bool Entity::addComponent(Component *component) {
-     if (_components.insert({component->getOrder(), component}).second) {
-          return true;
+     const int order = component->getOrder();
+     if (order < 0) {
+          return false;
      }
-     return false;
+     if (static_cast<size_t>(order) >= _slots.size()) {
+          _slots.resize(order + 1, nullptr);
+     }
+     if (_slots[order] != nullptr) {
+          return false;
+     }
+     _slots[order] = component;
+     auto position = std::ranges::lower_bound(_components, order, {}, &Component::getOrder);
+     _components.insert(position, component);
+     return true;
+}
+
+const std::vector<Component*>& Entity::getComponents() const {
+     return _components;
 }
 
 void Entity::RegisterToLua(sol::state& lua) {
-     sol::usertype<Entity> type = lua.new_usertype<Entity>("Entity");
-     type["destroy"] = &Entity::destroy;
-     type["setActive"] = &Entity::setActive;
-     type["isActive"] = &Entity::isActive;
+     sol::usertype<EntityHandle> type = lua.new_usertype<EntityHandle>("Entity");
+     type["destroy"] = [](const EntityHandle& handle) {
+          if (Entity* entity = handle.get()) handle.getScene()->destroyEntity(entity);
+     };
+     type["setActive"] = [](const EntityHandle& handle, const bool active) {
+          if (Entity* entity = handle.get()) handle.getScene()->setEntityActive(entity, active);
+     };
+     type["isActive"] = [](const EntityHandle& handle) {
+          const Entity* entity = handle.get();
+          return entity != nullptr && entity->isActive();
+     };
+     type["isValid"] = &EntityHandle::valid;
+     type["isPending"] = &EntityHandle::pending;
 }
@@ -1,8 +1,8 @@
 #ifndef ENTITY_H
 #define ENTITY_H
-#include <map>
-#include <unordered_set>
+#include <vector>
 #include "Component.h"
+#include "EntityHandle.h"
 #include <sol/forward.hpp>
 
 class RenderManager;
@@ -10,34 +10,42 @@ class Component;
 
 class Entity {
 private:
-    std::map<int, Component*> _components;
-    std::unordered_set<Entity*> _children;
+    std::vector<Component*> _slots;
+    std::vector<Component*> _components;
+    std::vector<Entity*> _children;
     Entity* _parent;
+    EntityHandle _handle;
     bool _active;
+    bool _effectiveActive;
     bool _alive;
+    void refreshActive();
 public:
     Entity();
+    Entity(const Entity&) = delete;
+    Entity& operator=(const Entity&) = delete;
     bool init();
-    bool update();
-    bool fixedUpdate();
     bool isActive() const;
     void setActive(bool active);
     bool isAlive() const;
     void destroy();
     bool addChild(Entity* child);
     void removeChild(Entity* child);
+    const std::vector<Entity*>& getChildren() const;
     void setParent(Entity* parent);
     Entity* getParent() const;
+    void setHandle(const EntityHandle& handle);
+    const EntityHandle& getHandle() const;
 
     bool addComponent(Component *component);
+    const std::vector<Component*>& getComponents() const;
 
     template<class ComponentType>
     ComponentType* getComponent() {
-        auto finder = _components.find(ComponentType::order);
-        if (finder == _components.end()) {
+        const auto order = static_cast<size_t>(ComponentType::order);
+        if (order >= _slots.size()) {
             return nullptr;
         }
-        return static_cast<ComponentType*>(finder->second);
+        return static_cast<ComponentType*>(_slots[order]);
     }
 
 
@@ -1,9 +1,11 @@
 #include "EntityBlueprint.h"
 
 #include <Load/LuaReader.h>
+#include <Utils/MemorySize.h>
 #include <sol/sol.hpp>
 
 #include "ComponentData.h"
+#include "ComponentSchema.h"
 
 void EntityBlueprint::readChildren(sol::table const& childrenBlueprint) {
     for (auto const& [key,child] : childrenBlueprint) {
@@ -16,7 +18,9 @@ void EntityBlueprint::readComponents(sol::table const& componentBlueprints) {
     for (auto const& [id,component] : componentBlueprints) {
         if (!id.is<std::string>() || !component.is<sol::table>())
             continue;
-        _components.push_back(ComponentData(id.as<std::string>(), component.as<sol::table>()));
+        std::string name = id.as<std::string>();
+        ComponentSchema const* schema = ComponentSchema::Get(name);
+        _components.push_back(ComponentData(name, schema ? schema->compile(component.as<sol::table>()) : nullptr));
     }
 }
 
@@ -63,6 +67,15 @@ const std::string & EntityBlueprint::getHandler() const{
     return _handler;
 }
 
+size_t EntityBlueprint::getMemorySize() const {
+    size_t size = _children.capacity() * sizeof(EntityBlueprint) + _components.capacity() * sizeof(ComponentData) + MemorySize::Of(_handler);
+    for (EntityBlueprint const& child : _children)
+        size += child.getMemorySize();
+    for (ComponentData const& component : _components)
+        size += component.getMemorySize();
+    return size;
+}
+
 EntityBlueprint::EntityBlueprint(sol::table const& blueprint) {
     read(blueprint);
 }
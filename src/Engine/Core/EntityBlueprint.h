@@ -28,6 +28,7 @@ public:
     const std::vector<ComponentData>& getComponents() const;
     bool getActive() const;
     const std::string& getHandler() const;
+    size_t getMemorySize() const;
 
 
 };
@@ -0,0 +1,38 @@
+#include "EntityHandle.h"
+#include "Scene.h"
+
+EntityHandle::EntityHandle() : _scene(nullptr), _index(0), _generation(0) {
+}
+
+EntityHandle::EntityHandle(Scene* scene, const uint32_t index, const uint32_t generation) :
+    _scene(scene), _index(index), _generation(generation) {
+}
+
+Entity* EntityHandle::get() const {
+    if (_scene == nullptr || _scene->isEntityPending(*this)) return nullptr;
+    return _scene->getEntity(*this);
+}
+
+bool EntityHandle::valid() const {
+    return get() != nullptr;
+}
+
+bool EntityHandle::pending() const {
+    return _scene != nullptr && _scene->isEntityPending(*this);
+}
+
+Scene* EntityHandle::getScene() const {
+    return _scene;
+}
+
+uint32_t EntityHandle::getIndex() const {
+    return _index;
+}
+
+uint32_t EntityHandle::getGeneration() const {
+    return _generation;
+}
+
+bool EntityHandle::operator==(const EntityHandle& other) const {
+    return _scene == other._scene && _index == other._index && _generation == other._generation;
+}
@@ -0,0 +1,25 @@
+#ifndef ENTITYHANDLE_H
+#define ENTITYHANDLE_H
+#include <cstdint>
+
+class Scene;
+class Entity;
+
+class EntityHandle {
+private:
+    Scene* _scene;
+    uint32_t _index;
+    uint32_t _generation;
+public:
+    EntityHandle();
+    EntityHandle(Scene* scene, uint32_t index, uint32_t generation);
+    Entity* get() const;
+    bool valid() const;
+    bool pending() const;
+    Scene* getScene() const;
+    uint32_t getIndex() const;
+    uint32_t getGeneration() const;
+    bool operator==(const EntityHandle& other) const;
+};
+
+#endif //ENTITYHANDLE_H
@@ -8,7 +8,7 @@ Game::Game(SceneManager* manager) : _manager(manager)
 {
 }
 
-Entity* Game::instantiatePrefab(const std::string& handler) const {
+EntityHandle Game::instantiatePrefab(const std::string& handler) const {
 	return _manager->instantiatePrefab(handler);
 }
 
@@ -22,7 +22,11 @@ void Game::popScene() const {
 
 void Game::RegisterToLua(sol::state& lua) {
 	sol::usertype<Game> type = lua.new_usertype<Game>("Game");
-	type["instantiatePrefab"] = &Game::instantiatePrefab;
+	type["instantiatePrefab"] = [](const Game& game, const std::string& handler) -> sol::optional<EntityHandle> {
+		EntityHandle handle = game.instantiatePrefab(handler);
+		if (handle.getScene() == nullptr) return sol::nullopt;
+		return handle;
+	};
 	type["addScene"] = &Game::addScene;
 	type["popScene"] = &Game::popScene;
 }
@@ -2,6 +2,7 @@
 #define GAME_H
 #include <string>
 #include <sol/forward.hpp>
+#include "EntityHandle.h"
 
 class SceneManager;
 class Scene;
@@ -12,7 +13,7 @@ private:
     SceneManager* _manager;
 public:
     explicit Game(SceneManager* manager);
-    Entity* instantiatePrefab(const std::string& handler) const;
+    EntityHandle instantiatePrefab(const std::string& handler) const;
     Scene* addScene(const std::string& handler) const;
     void popScene() const;
 
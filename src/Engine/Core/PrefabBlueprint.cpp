@@ -11,10 +11,15 @@ bool PrefabBlueprint::load() {
     if (!blueprint.valid())
         return false;
     EntityBlueprint::read(blueprint);
-    _size = 0;
+    _size = sizeof(PrefabBlueprint) + EntityBlueprint::getMemorySize();
     return true;
 }
 
 void PrefabBlueprint::unload() {
     EntityBlueprint::clear();
+    _size = 0;
+}
+
+std::string_view PrefabBlueprint::getBudget() const {
+    return "prefabs";
 }
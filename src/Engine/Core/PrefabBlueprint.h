@@ -9,6 +9,7 @@ public:
     explicit PrefabBlueprint(std::string const& path);
     bool load() override;
     void unload() override;
+    std::string_view getBudget() const override;
 };
 
 
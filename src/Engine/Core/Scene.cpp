@@ -1,43 +1,94 @@
 #include "Scene.h"
 #include "Entity.h"
 #include "Render/RenderComponent.h"
+#include "Render/RenderManager.h"
 #include <sol/state.hpp>
+#include <algorithm>
+#include <Collisions/CollisionManager.h>
+#include <Utils/Error.h>
 
-Scene::Scene()
-= default;
+Scene::Scene() : _updateListsDirty(false), _deferCommands(false), _batchRegistrations(false) {
+}
+
+Scene::~Scene() {
+	_entities.clear();
+	_entitiesToAdd.clear();
+	_handlers.clear();
+	for (EntitySlot& slot : _slots) {
+		if (slot.entity) {
+			releaseComponents(&*slot.entity);
+			slot.entity.reset();
+		}
+	}
+	_slots.clear();
+	_pools.clear();
+}
 
 bool Scene::init() {
 	refresh();
-	for (Entity* entity : _entities) {
-		if (!entity->init()) {
+	for (const EntityHandle& handle : _entities) {
+		Entity* entity = getEntity(handle);
+		if (entity && !entity->init()) {
 			return false;
 		}
 	}
 	return true;
 }
 
-bool Scene::update() const {
-	for (Entity* entity : _entities) {
-		if (entity->isActive() && !entity->update()) {
-			return false;
+bool Scene::update() {
+	_deferCommands = true;
+	for (size_t type = 0; type < _updateLists.size(); ++type) {
+		for (size_t i = 0, size = _updateLists[type].size(); i < size; ++i) {
+			Component* component = _updateLists[type][i];
+			if (component && component->isEnabled() && component->isEntityActive() && !component->update()) {
+				_deferCommands = false;
+				return false;
+			}
 		}
 	}
+	_deferCommands = false;
 	return true;
 }
 
-bool Scene::fixedUpdate() const {
-	for (Entity* entity : _entities) {
-		if (entity->isActive() && !entity->fixedUpdate()) {
-			return false;
+bool Scene::fixedUpdate() {
+	_deferCommands = true;
+	for (size_t type = 0; type < _fixedUpdateLists.size(); ++type) {
+		for (size_t i = 0, size = _fixedUpdateLists[type].size(); i < size; ++i) {
+			Component* component = _fixedUpdateLists[type][i];
+			if (component && component->isEnabled() && component->isEntityActive() && !component->fixedUpdate()) {
+				_deferCommands = false;
+				return false;
+			}
 		}
 	}
+	_deferCommands = false;
 	return true;
 }
 
 bool Scene::render(RenderManager* manager) {
-	for (const auto& [layer, components] : _renderComponents) {
-		for (const auto& component : components) {
-			if (component->isEnabled() && component->isEntityActive() && !component->render(manager)) {
+	for (RenderComponent* component : _movedRenderComponents) {
+		if (auto layerFinder = _renderComponents.find(component->getLayer()); layerFinder != _renderComponents.end()) {
+			if (component->isStatic()) layerFinder->second.staticComponents.update(component);
+			else layerFinder->second.components.update(component);
+		}
+	}
+	_movedRenderComponents.clear();
+	_renderQueue.beginFrame();
+	for (auto& [layer, renderLayer] : _renderComponents) {
+		Rect view = manager->getViewRect();
+		if (!renderLayer.staticComponents.empty() && !renderLayer.staticComponents.render(manager, view)) {
+			return false;
+		}
+		renderLayer.components.query(view, _visibleRenderComponents);
+		_renderQueue.clear();
+		for (RenderComponent* component : _visibleRenderComponents) {
+			if (component->isEnabled() && component->isEntityActive()) {
+				_renderQueue.push(component);
+			}
+		}
+		_renderQueue.sort();
+		for (const RenderQueue::Item& item : _renderQueue.getItems()) {
+			if (!item.component->render(manager)) {
 				return false;
 			}
 		}
@@ -47,53 +98,307 @@ bool Scene::render(RenderManager* manager) {
 
 void Scene::refresh()
 {
-	for (auto entity = _entities.begin(); entity != _entities.end();) {
-		if (!(*entity)->isAlive()) {
-			delete *entity;
-			entity = _entities.erase(entity);
+	_batchRegistrations = true;
+	CollisionManager::Instance()->beginBatch();
+	applyCommands();
+	std::erase_if(_entities, [this](const EntityHandle& handle) {
+		Entity* entity = getEntity(handle);
+		if (entity == nullptr) {
+			return true;
+		}
+		if (!entity->isAlive()) {
+			releaseEntity(entity);
+			return true;
+		}
+		return false;
+	});
+	for (const EntityHandle& handle : _entitiesToAdd) {
+		if (getEntity(handle) != nullptr) {
+			_entities.push_back(handle);
 		}
-		else ++entity;
-	}
-	for (auto entity : _entitiesToAdd) {
-		_entities.insert(entity);
 	}
 	_entitiesToAdd.clear();
+	if (_updateListsDirty) {
+		compactLists(_updateLists, &Component::_updateIndex);
+		compactLists(_fixedUpdateLists, &Component::_fixedUpdateIndex);
+		_updateListsDirty = false;
+	}
+	_batchRegistrations = false;
+	flushRenderRegistrations();
+	CollisionManager::Instance()->endBatch();
+}
+
+void Scene::applyCommands() {
+	for (size_t i = 0; i < _commands.size(); ++i) {
+		applyCommand(_commands[i]);
+	}
+	_commands.clear();
+}
+
+void Scene::applyCommand(const Command& command) {
+	Entity* entity = getEntity(command.entity);
+	if (entity == nullptr) {
+		return;
+	}
+	switch (command.type) {
+		case CommandType::INIT:
+			_slots[command.entity.getIndex()].pending = false;
+			if (!entity->init()) {
+				Error::ShowError("Error al instanciar entidad", "Fallo al inicializar una entidad instanciada durante el update");
+				releaseEntity(entity);
+			}
+			break;
+		case CommandType::DESTROY:
+			entity->destroy();
+			break;
+		case CommandType::SET_ACTIVE:
+			entity->setActive(command.active);
+			break;
+		case CommandType::REPARENT: {
+			Entity* parent = getEntity(command.parent);
+			for (const Entity* ancestor = parent; ancestor != nullptr; ancestor = ancestor->getParent()) {
+				if (ancestor == entity) {
+					Error::ShowError("Error al cambiar el padre de una entidad", "Una entidad no puede ser hija de sí misma ni de uno de sus descendientes");
+					return;
+				}
+			}
+			if (Entity* oldParent = entity->getParent()) {
+				oldParent->removeChild(entity);
+			}
+			else {
+				std::erase(_entities, command.entity);
+				std::erase(_entitiesToAdd, command.entity);
+			}
+			if (parent == nullptr || !parent->addChild(entity)) {
+				entity->setParent(nullptr);
+				_entitiesToAdd.push_back(command.entity);
+			}
+			break;
+		}
+	}
+}
+
+void Scene::flushRenderRegistrations() {
+	std::ranges::stable_sort(_pendingRenderRegistrations, {}, &RenderRegistration::layer);
+	for (const auto& [component, layer] : _pendingRenderRegistrations) {
+		registerRenderComponent(component, layer);
+	}
+	_pendingRenderRegistrations.clear();
+}
+
+Entity* Scene::createEntity() {
+	uint32_t index;
+	if (!_freeSlots.empty()) {
+		index = _freeSlots.back();
+		_freeSlots.pop_back();
+	}
+	else {
+		index = static_cast<uint32_t>(_slots.size());
+		_slots.emplace_back();
+	}
+	EntitySlot& slot = _slots[index];
+	Entity& entity = slot.entity.emplace();
+	entity.setHandle(EntityHandle(this, index, slot.generation));
+	return &entity;
+}
+
+void Scene::releaseEntity(Entity* entity) {
+	if (entity == nullptr || getEntity(entity->getHandle()) != entity) {
+		return;
+	}
+	for (Entity* child : std::vector(entity->getChildren())) {
+		releaseEntity(child);
+	}
+	if (Entity* parent = entity->getParent()) {
+		parent->removeChild(entity);
+	}
+	releaseComponents(entity);
+	const uint32_t index = entity->getHandle().getIndex();
+	EntitySlot& slot = _slots[index];
+	slot.entity.reset();
+	slot.pending = false;
+	++slot.generation;
+	_freeSlots.push_back(index);
+}
+
+void Scene::addToList(std::vector<std::vector<Component*>>& lists, Component* component, size_t Component::* index) {
+	const auto order = static_cast<size_t>(component->getOrder());
+	if (order >= lists.size()) {
+		lists.resize(order + 1);
+	}
+	component->*index = lists[order].size();
+	lists[order].push_back(component);
+}
+
+bool Scene::removeFromList(std::vector<std::vector<Component*>>& lists, Component* component, size_t Component::* index) {
+	const auto order = static_cast<size_t>(component->getOrder());
+	if (order >= lists.size()) {
+		return false;
+	}
+	std::vector<Component*>& list = lists[order];
+	if (component->*index < list.size() && list[component->*index] == component) {
+		list[component->*index] = nullptr;
+		return true;
+	}
+	return false;
+}
+
+void Scene::compactLists(std::vector<std::vector<Component*>>& lists, size_t Component::* index) {
+	for (auto& list : lists) {
+		std::erase(list, nullptr);
+		for (size_t i = 0; i < list.size(); ++i) {
+			list[i]->*index = i;
+		}
+	}
+}
+
+void Scene::registerComponent(Component* component) {
+	if (component->overridesUpdate()) {
+		addToList(_updateLists, component, &Component::_updateIndex);
+	}
+	if (component->overridesFixedUpdate()) {
+		addToList(_fixedUpdateLists, component, &Component::_fixedUpdateIndex);
+	}
+}
+
+void Scene::releaseComponent(Component* component) {
+	if (component->overridesUpdate() && removeFromList(_updateLists, component, &Component::_updateIndex)) {
+		_updateListsDirty = true;
+	}
+	if (component->overridesFixedUpdate() && removeFromList(_fixedUpdateLists, component, &Component::_fixedUpdateIndex)) {
+		_updateListsDirty = true;
+	}
+	const auto order = static_cast<size_t>(component->getOrder());
+	if (order < _pools.size() && _pools[order]) {
+		_pools[order]->release(component);
+	}
+}
+
+void Scene::releaseComponents(Entity* entity) {
+	for (Component* component : entity->getComponents()) {
+		releaseComponent(component);
+	}
+}
+
+Entity* Scene::getEntity(const EntityHandle& handle) {
+	if (handle.getScene() != this || handle.getIndex() >= _slots.size()) {
+		return nullptr;
+	}
+	EntitySlot& slot = _slots[handle.getIndex()];
+	if (slot.generation != handle.getGeneration() || !slot.entity) {
+		return nullptr;
+	}
+	return &*slot.entity;
+}
+
+bool Scene::isEntityPending(const EntityHandle& handle) {
+	for (const Entity* entity = getEntity(handle); entity != nullptr; entity = entity->getParent()) {
+		if (_slots[entity->getHandle().getIndex()].pending) {
+			return true;
+		}
+	}
+	return false;
 }
 
 void Scene::addEntity(Entity* entity)
 {
-	_entitiesToAdd.insert(entity);
+	_entitiesToAdd.push_back(entity->getHandle());
+}
+
+bool Scene::initEntity(Entity* entity) {
+	if (_deferCommands) {
+		_slots[entity->getHandle().getIndex()].pending = true;
+		_commands.push_back({CommandType::INIT, entity->getHandle(), {}, false});
+		return true;
+	}
+	if (!entity->init()) {
+		releaseEntity(entity);
+		return false;
+	}
+	return true;
+}
+
+void Scene::destroyEntity(Entity* entity) {
+	if (_deferCommands) _commands.push_back({CommandType::DESTROY, entity->getHandle(), {}, false});
+	else entity->destroy();
 }
 
-void Scene::addHandler(Entity* entity, const std::string &handler) {
-	if (!_handlers.contains(handler)) {
-		_handlers.insert({handler, entity});
+void Scene::setEntityActive(Entity* entity, const bool active) {
+	if (_deferCommands) _commands.push_back({CommandType::SET_ACTIVE, entity->getHandle(), {}, active});
+	else entity->setActive(active);
+}
+
+void Scene::reparentEntity(Entity* entity, Entity* parent) {
+	Command command = {CommandType::REPARENT, entity->getHandle(), parent ? parent->getHandle() : EntityHandle(), false};
+	if (_deferCommands) _commands.push_back(command);
+	else applyCommand(command);
+}
+
+void Scene::addHandler(Entity* entity, const Symbol& handler) {
+	auto [it, inserted] = _handlers.insert({handler, entity->getHandle()});
+	if (!inserted && getEntity(it->second) == nullptr) {
+		it->second = entity->getHandle();
 	}
 }
 
-Entity* Scene::getEntityByHandler(const std::string& handler)
+Entity* Scene::getEntityByHandler(const Symbol& handler)
 {
 	auto entityFinder = _handlers.find(handler);
 	if (entityFinder == _handlers.end()) return nullptr;
+	return getEntity(entityFinder->second);
+}
+
+EntityHandle Scene::getHandleByHandler(const Symbol& handler) const
+{
+	auto entityFinder = _handlers.find(handler);
+	if (entityFinder == _handlers.end()) return {};
 	return entityFinder->second;
 }
 
 void Scene::registerRenderComponent(RenderComponent* component, int layer)
 {
-	_renderComponents[layer].insert(component);
+	if (_batchRegistrations) {
+		_pendingRenderRegistrations.push_back({component, layer});
+		return;
+	}
+	RenderLayer& renderLayer = _renderComponents[layer];
+	if (component->isStatic()) renderLayer.staticComponents.insert(component);
+	else renderLayer.components.insert(component);
+	_movedRenderComponents.push_back(component);
 }
 
 void Scene::unregisterRenderComponent(RenderComponent* component, const int layer)
 {
+	std::erase_if(_pendingRenderRegistrations, [component](const RenderRegistration& registration) {
+		return registration.component == component;
+	});
 	if (auto layerFinder = _renderComponents.find(layer); layerFinder != _renderComponents.end()) {
-		layerFinder->second.erase(component);
-		if (layerFinder->second.empty()) {
+		RenderLayer& renderLayer = layerFinder->second;
+		if (component->isStatic()) renderLayer.staticComponents.remove(component);
+		else renderLayer.components.remove(component);
+		if (renderLayer.components.empty() && renderLayer.staticComponents.empty()) {
 			_renderComponents.erase(layerFinder);
 		}
 	}
+	std::erase(_movedRenderComponents, component);
+}
+
+void Scene::markRenderBoundsDirty(RenderComponent* component)
+{
+	_movedRenderComponents.push_back(component);
 }
 
 void Scene::RegisterToLua(sol::state& lua) {
 	sol::usertype<Scene> type = lua.new_usertype<Scene>("Scene");
-	type["getEntity"] = &Scene::getEntityByHandler;
+	type["getEntity"] = sol::overload(
+		[](const Scene& scene, const Symbol& handler) -> sol::optional<EntityHandle> {
+			EntityHandle handle = scene.getHandleByHandler(handler);
+			if (!handle.valid()) return sol::nullopt;
+			return handle;
+		},
+		[](const Scene& scene, const std::string& handler) -> sol::optional<EntityHandle> {
+			EntityHandle handle = scene.getHandleByHandler(handler);
+			if (!handle.valid()) return sol::nullopt;
+			return handle;
+		});
 }
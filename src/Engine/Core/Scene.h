@@ -1,33 +1,115 @@
 #ifndef SCENE_H
 #define SCENE_H
 #include <string>
+#include <deque>
 #include <map>
+#include <memory>
+#include <optional>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 #include <sol/forward.hpp>
+#include "ComponentPool.h"
+#include <Utils/Symbol.h>
+#include "Entity.h"
+#include "EntityHandle.h"
+#include <Render/RenderGrid.h>
+#include <Render/RenderQueue.h>
+#include <Render/StaticLayerCache.h>
 
-class Entity;
 class RenderComponent;
 class RenderManager;
 
 class Scene {
 private:
-    std::unordered_map<std::string, Entity*> _handlers;
-    std::unordered_set<Entity*> _entities;
-    std::unordered_set<Entity*> _entitiesToAdd;
-    std::map<int, std::unordered_set<RenderComponent*>> _renderComponents;
+    struct EntitySlot {
+        std::optional<Entity> entity;
+        uint32_t generation = 0;
+        bool pending = false;
+    };
+    enum class CommandType {
+        INIT,
+        DESTROY,
+        SET_ACTIVE,
+        REPARENT
+    };
+    struct Command {
+        CommandType type;
+        EntityHandle entity;
+        EntityHandle parent;
+        bool active;
+    };
+    struct RenderRegistration {
+        RenderComponent* component;
+        int layer;
+    };
+    std::deque<EntitySlot> _slots;
+    std::vector<uint32_t> _freeSlots;
+    std::unordered_map<Symbol, EntityHandle> _handlers;
+    std::vector<EntityHandle> _entities;
+    std::vector<EntityHandle> _entitiesToAdd;
+    struct RenderLayer {
+        RenderGrid components;
+        StaticLayerCache staticComponents;
+    };
+    std::map<int, RenderLayer> _renderComponents;
+    std::vector<RenderComponent*> _movedRenderComponents;
+    std::vector<RenderComponent*> _visibleRenderComponents;
+    RenderQueue _renderQueue;
+    std::vector<std::unique_ptr<BaseComponentPool>> _pools;
+    std::vector<std::vector<Component*>> _updateLists;
+    std::vector<std::vector<Component*>> _fixedUpdateLists;
+    bool _updateListsDirty;
+    std::vector<Command> _commands;
+    bool _deferCommands;
+    std::vector<RenderRegistration> _pendingRenderRegistrations;
+    bool _batchRegistrations;
+
+    void releaseComponents(Entity* entity);
+    void applyCommands();
+    void applyCommand(const Command& command);
+    void flushRenderRegistrations();
+    static void addToList(std::vector<std::vector<Component*>>& lists, Component* component, size_t Component::* index);
+    static bool removeFromList(std::vector<std::vector<Component*>>& lists, Component* component, size_t Component::* index);
+    static void compactLists(std::vector<std::vector<Component*>>& lists, size_t Component::* index);
 public:
     Scene();
+    ~Scene();
+    Scene(const Scene&) = delete;
+    Scene& operator=(const Scene&) = delete;
     bool init();
-    bool update() const;
-    bool fixedUpdate() const;
+    bool update();
+    bool fixedUpdate();
     bool render(RenderManager* manager);
     void refresh();
+    Entity* createEntity();
+    void releaseEntity(Entity* entity);
+    Entity* getEntity(const EntityHandle& handle);
+    bool isEntityPending(const EntityHandle& handle);
+    template<typename ComponentType>
+    ComponentPool<ComponentType>* getPool() {
+        const auto order = static_cast<size_t>(ComponentType::order);
+        if (order >= _pools.size()) {
+            _pools.resize(order + 1);
+        }
+        if (!_pools[order]) {
+            _pools[order] = std::make_unique<ComponentPool<ComponentType>>();
+        }
+        return static_cast<ComponentPool<ComponentType>*>(_pools[order].get());
+    }
+    void registerComponent(Component* component);
+    void releaseComponent(Component* component);
     void addEntity(Entity* entity);
-    void addHandler(Entity* entity, const std::string & handler);
-    Entity* getEntityByHandler(const std::string & handler);
+    bool initEntity(Entity* entity);
+    void destroyEntity(Entity* entity);
+    void setEntityActive(Entity* entity, bool active);
+    void reparentEntity(Entity* entity, Entity* parent);
+    void addHandler(Entity* entity, const Symbol& handler);
+    Entity* getEntityByHandler(const Symbol& handler);
+    EntityHandle getHandleByHandler(const Symbol& handler) const;
     void registerRenderComponent(RenderComponent* component , int layer);
     void unregisterRenderComponent(RenderComponent* component, int layer);
+    void markRenderBoundsDirty(RenderComponent* component);
 
     static void RegisterToLua(sol::state& lua);
 };
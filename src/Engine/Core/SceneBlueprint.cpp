@@ -14,12 +14,19 @@ bool SceneBlueprint::load() {
         if (value.valid())
             _entities.emplace_back(value);
     }
-    _size = 0;
+    _size = sizeof(SceneBlueprint) + _entities.capacity() * sizeof(EntityBlueprint);
+    for (EntityBlueprint const& entity : _entities)
+        _size += entity.getMemorySize();
     return true;
 }
 
 void SceneBlueprint::unload() {
     _entities.clear();
+    _size = 0;
+}
+
+std::string_view SceneBlueprint::getBudget() const {
+    return "scenes";
 }
 
 const std::vector<EntityBlueprint> & SceneBlueprint::getEntities() const {
@@ -13,6 +13,7 @@ public:
     SceneBlueprint(std::string const &path);
     bool load() override;
     void unload() override;
+    std::string_view getBudget() const override;
     const std::vector<EntityBlueprint>& getEntities() const;
 };
 
@@ -29,27 +29,30 @@ SceneManager::~SceneManager()
 Entity* SceneManager::createEntity(const EntityBlueprint* blueprint, Scene* scene)
 {
 	if (blueprint == nullptr) return nullptr;
-	Entity* entity = new Entity();
+	Entity* entity = scene->createEntity();
 	for (const EntityBlueprint& childBp : blueprint->getChildren()) {
 		Entity* child = createEntity(&childBp, scene);
 		if (!child) {
-			delete entity;
+			scene->releaseEntity(entity);
 			return nullptr;
 		}
 		if (!entity->addChild(child)) {
-			delete child;
-			delete entity;
+			scene->releaseEntity(child);
+			scene->releaseEntity(entity);
 			return nullptr;
 		}
 	}
 	for (ComponentData const& data : blueprint->getComponents()) {
-		Component* component = _factory->createComponent(&data);
+		Component* component = _factory->createComponent(&data, scene);
 		if (!component) {
-			delete entity;
+			scene->releaseEntity(entity);
 			return nullptr;
 		}
-		entity->addComponent(component);
 		component->setContext(entity,scene,_game);
+		if (!entity->addComponent(component)) {
+			scene->releaseComponent(component);
+		}
+		else scene->registerComponent(component);
 	}
 	entity->setActive(blueprint->getActive());
 	if (blueprint->getHandler() != "") scene->addHandler(entity, blueprint->getHandler());
@@ -116,17 +119,19 @@ void SceneManager::shutdown() const {
 	delete this;
 }
 
-Entity* SceneManager::instantiatePrefab(const std::string& handler)
+EntityHandle SceneManager::instantiatePrefab(const std::string& handler)
 {
-	Entity* prefab = createEntity(ResourceHandler<PrefabBlueprint>::Instance()->get(handler),_scenes.back());
-	if (prefab) {
-		_scenes.back()->addEntity(prefab);
-		if (!prefab->init()) {
-			delete prefab;
-			return nullptr;
-		}
+	Scene* scene = _scenes.back();
+	Entity* prefab = createEntity(ResourceHandler<PrefabBlueprint>::Instance()->get(handler),scene);
+	if (prefab == nullptr) {
+		return {};
+	}
+	EntityHandle handle = prefab->getHandle();
+	scene->addEntity(prefab);
+	if (!scene->initEntity(prefab)) {
+		return {};
 	}
-	return prefab;
+	return handle;
 }
 
 Scene* SceneManager::addScene(const std::string& handler)
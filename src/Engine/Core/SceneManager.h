@@ -2,6 +2,7 @@
 #define SCENEMANAGER_H
 #include <list>
 #include <string>
+#include "EntityHandle.h"
 
 
 class RenderManager;
@@ -34,7 +35,7 @@ class SceneManager {
     bool render(RenderManager* render) const;
     void refresh() const;
     void shutdown() const;
-    Entity* instantiatePrefab(const std::string& handler);
+    EntityHandle instantiatePrefab(const std::string& handler);
     Scene* addScene(const std::string& handler);
     void popScene();
 
@@ -6,49 +6,21 @@
 #include <Render/Font.h>
 #include <Render/Text.h>
 #include <Utils/Error.h>
-#include <SDL3_ttf/SDL_ttf.h>
 #include <Utils/Time.h>
+#include <Utils/UTF8.h>
 #include <Utils/TimeManager.h>
 #include <sol/state.hpp>
 #include <Gameplay/Movement/PlayerInput.h>
 
 void TextBox::splitText(const std::string &fullText) {
     const Font* font = ResourceHandler<Font>::Instance()->get(_text->getFont());
-    int maxWidth = _text->getSize().getX() * 0.97f;
-    int maxHeight = _text->getSize().getY();
-    int lineHeight = TTF_GetFontHeight(font->getFont());
-    int maxLines = maxHeight / lineHeight;
-
-    std::istringstream stream(fullText);
-    std::string line;
-    std::string paragraph;
-    std::string word;
-    std::string lineCheck;
-    int textWidth;
-    while (std::getline(stream, line, '\n')) {
-        std::istringstream lineStream(line);
-        int nLines = 1;
-        while (lineStream >> word) {
-            lineCheck += word + " ";
-            TTF_GetStringSize(font->getFont(), lineCheck.c_str(), lineCheck.size(), &textWidth, nullptr);
-            if (textWidth >= maxWidth) {
-                paragraph.back() = '\n';
-                lineCheck = word + " ";
-                nLines++;
-                if (nLines > maxLines) {
-                    _dialog.push_back(paragraph);
-                    paragraph.clear();
-                    nLines = 1;
-                }
-            }
-            paragraph += word + " ";
-        }
-        if (!paragraph.empty()) {
-            _dialog.push_back(paragraph);
-            paragraph.clear();
-            lineCheck.clear();
-        }
-    }
+    if (!font) return;
+    size_t begin = _dialog.size();
+    bool wasEmpty = _layout.getParagraphs().empty();
+    _dialog += fullText;
+    _layout.layout(font, _dialog, begin, _text->getSize().getX() * 0.97f, _text->getSize().getY());
+    if (wasEmpty && !_layout.getParagraphs().empty())
+        _lineIter = _layout.getParagraphs().front().firstLine;
 }
 
 TextBox::TextBox(ComponentData const *data) : ComponentTemplate(data) {
@@ -71,27 +43,35 @@ bool TextBox::init() {
         return false;
     }
     _text->setText("");
-    _characterDelay = _data->getData<float>("wordDelay", 0.01f);
+    _characterDelay = _data->get<Data>().wordDelay;
 
     return true;
 }
 
 bool TextBox::update() {
     _timer += Time::deltaTime;
-    if (_paragraphIter < _dialog.size()) {
+    const auto& paragraphs = _layout.getParagraphs();
+    if (_paragraphIter < paragraphs.size()) {
         if (_playerInput->isActive())
             _playerInput->setActive(false);
-        if (_charIter < _dialog[_paragraphIter].size()) {
+        if (_lineIter < paragraphs[_paragraphIter].lastLine) {
             float delay = _characterDelay * (InputManager::GetState().mouse_pressed ? .5f : 1);
             if (_timer >= delay) {
                 _timer = 0.0f;
-                std::string current(1,_dialog[_paragraphIter][_charIter]);
-                if (static_cast<unsigned char>(current[0]) > 0xC2 && _charIter+1 < _dialog[_paragraphIter].size()) {
-                    _charIter++;
-                    current += _dialog[_paragraphIter][_charIter];
+                const TextSpan& line = _layout.getLines()[_lineIter];
+                std::string_view text = std::string_view(_dialog).substr(0, line.end);
+                size_t begin = line.begin + _charIter;
+                size_t end = begin;
+                uint32_t codepoint;
+                if (!UTF8::Decode(text, end, codepoint))
+                    end = line.end;
+                _text->appendText(text.substr(begin, end - begin));
+                _charIter = end - line.begin;
+                if (end >= line.end) {
+                    _charIter = 0;
+                    if (++_lineIter < paragraphs[_paragraphIter].lastLine)
+                        _text->appendText("\n");
                 }
-                _text->setText(_text->getText() + current);
-                _charIter++;
             }
         } else {
             if (InputManager::GetState().mouse_down) {
@@ -100,11 +80,16 @@ bool TextBox::update() {
                 _paragraphIter++;
                 _text->setText("");
                 if (ended()) {
-                    _entity->setActive(false);
+                    _scene->setEntityActive(_entity, false);
                     _paragraphIter = 0;
+                    _lineIter = 0;
                     _dialog.clear();
+                    _layout.clear();
                     _playerInput->setActive(true);
                 }
+                else {
+                    _lineIter = paragraphs[_paragraphIter].firstLine;
+                }
             }
         }
     }
@@ -112,11 +97,11 @@ bool TextBox::update() {
 }
 
 bool TextBox::ended() const {
-    return _paragraphIter == _dialog.size();
+    return _paragraphIter == _layout.getParagraphs().size();
 }
 
 void TextBox::setText(const std::string &fullText) {
-    _entity->setActive(true);
+    _scene->setEntityActive(_entity, true);
     splitText(fullText);
 }
 
@@ -126,3 +111,7 @@ void TextBox::RegisterToLua(sol::state& lua) {
     type["ended"] = &TextBox::ended;
     type["get"] = TextBox::get;
 }
+
+void TextBox::DeclareSchema(ComponentSchemaTemplate<Data>& schema) {
+    schema.field("wordDelay", &Data::wordDelay, 0.01f);
+}
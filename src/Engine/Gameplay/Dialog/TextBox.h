@@ -3,6 +3,7 @@
 #include <string>
 #include <vector>
 #include <Core/ComponentTemplate.h>
+#include <Render/TextLayout.h>
 
 class PlayerInput;
 class Text;
@@ -10,14 +11,19 @@ class Text;
 class ComponentClass(TextBox) {
     private:
         Text* _text {};
-        std::vector<std::string> _dialog;
+        std::string _dialog;
+        TextLayout _layout;
         float _characterDelay {};
         float _timer {};
-        size_t _charIter {}, _paragraphIter {};
+        size_t _charIter {}, _lineIter {}, _paragraphIter {};
         PlayerInput* _playerInput {};
         void splitText(const std::string& fullText);
     public:
+        struct Data : ComponentFields {
+            float wordDelay;
+        };
         TextBox(ComponentData const* data);
+        static void DeclareSchema(ComponentSchemaTemplate<Data>& schema);
         bool init() override;
         bool update() override;
         bool ended() const;
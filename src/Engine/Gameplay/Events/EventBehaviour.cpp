@@ -63,7 +63,7 @@ EventBehaviour* EventBehaviour::Create(Game* game, Scene* scene, Entity* entity,
 }
 
 bool EventBehaviour::init() {
-    return _init(_self, _scene, _entity, _event);
+    return _init(_self, _scene, _entity->getHandle(), _event);
 }
 
 bool EventBehaviour::onStart() {
@@ -71,7 +71,7 @@ bool EventBehaviour::onStart() {
 }
 
 bool EventBehaviour::act() {
-    return _act(_self, _game, _scene, _entity, _event);
+    return _act(_self, _game, _scene, _entity->getHandle(), _event);
 }
 
 bool EventBehaviour::done() const {
@@ -79,7 +79,7 @@ bool EventBehaviour::done() const {
 }
 
 bool EventBehaviour::ended() const {
-    return _ended(_self, _scene, _entity, _event);
+    return _ended(_self, _scene, _entity->getHandle(), _event);
 }
 
 void EventBehaviour::RegisterToLua(sol::state& lua) {
@@ -1,5 +1,6 @@
 #include "EventConditionFactory.h"
 
+#include <Core/Entity.h>
 #include <Load/LuaReader.h>
 #include <Utils/Error.h>
 
@@ -71,5 +72,7 @@ EventCondition* EventConditionFactory::Create(sol::table const& condition, Scene
 
 void EventConditionFactory::RegisterToLua(sol::state& luaState) {
     sol::usertype<EventConditionFactory> type = luaState.new_usertype<EventConditionFactory>("EventConditionFactory");
-    type["Create"] = EventConditionFactory::Create;
+    type["Create"] = [](sol::table const& condition, Scene* scene, EntityHandle const& entity, Event* event) {
+        return EventConditionFactory::Create(condition, scene, entity.get(), event);
+    };
 }
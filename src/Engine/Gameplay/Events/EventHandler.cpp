@@ -32,7 +32,7 @@ EventHandler::~EventHandler() {
 }
 
 bool EventHandler::init() {
-    auto events = _data->getData<sol::table>("events", sol::lua_nil);
+    const sol::table& events = _data->get<Data>().events;
     if (!events.valid()) {
         Error::ShowError("EventHandler", "Invalid events table");
         return false;
@@ -74,3 +74,7 @@ void EventHandler::RegisterToLua(sol::state& luaState) {
     type["getEvent"] = &EventHandler::getEvent;
     type["get"] = EventHandler::get;
 }
+
+void EventHandler::DeclareSchema(ComponentSchemaTemplate<Data>& schema) {
+    schema.field("events", &Data::events, sol::lua_nil);
+}
@@ -14,7 +14,11 @@ private:
 
     bool addEvent(std::string const& name, sol::table const& eventTable);
 public:
+    struct Data : ComponentFields {
+        sol::table events;
+    };
     explicit EventHandler(ComponentData const* data);
+    static void DeclareSchema(ComponentSchemaTemplate<Data>& schema);
     ~EventHandler() override;
     bool init() override;
     bool update() override;
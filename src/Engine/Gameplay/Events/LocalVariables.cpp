@@ -7,14 +7,12 @@ LocalVariables::LocalVariables(ComponentData const* data) :
 }
 
 bool LocalVariables::init() {
-    auto& data = _data->getData();
-    for (auto& [key, value] : data) {
-        if (!key.is<std::string>()) {
-            Error::ShowError("LocalVariables", "Key is not a string");
-            return false;
-        }
-        variables.insert({key.as<std::string>(), value.as<sol::lua_value>()});
+    const Data& data = _data->get<Data>();
+    if (!data.validKeys) {
+        Error::ShowError("LocalVariables", "Key is not a string");
+        return false;
     }
+    variables = data.variables;
     return true;
 }
 
@@ -40,4 +38,15 @@ void LocalVariables::RegisterToLua(sol::state& luaState) {
     type["get"] = LocalVariables::get;
 }
 
-
+void LocalVariables::DeclareSchema(ComponentSchemaTemplate<Data>& schema) {
+    schema.read([](Data& data, sol::table const& table) {
+        data.validKeys = true;
+        for (auto& [key, value] : table) {
+            if (!key.is<std::string>()) {
+                data.validKeys = false;
+                return;
+            }
+            data.variables.insert({key.as<std::string>(), value.as<sol::lua_value>()});
+        }
+    });
+}
@@ -9,7 +9,12 @@ class ComponentClass(LocalVariables) {
 private:
     std::unordered_map<std::string, sol::lua_value> variables;
 public:
+    struct Data : ComponentFields {
+        std::unordered_map<std::string, sol::lua_value> variables;
+        bool validKeys;
+    };
     explicit LocalVariables(ComponentData const* data);
+    static void DeclareSchema(ComponentSchemaTemplate<Data>& schema);
     bool init() override;
 
     sol::lua_value const& getVariable(std::string const& name) const;
@@ -1,6 +1,7 @@
 #include "MovementComponent.h"
 #include "MovementManager.h"
 #include <Core/ComponentData.h>
+#include <algorithm>
 #include <Core/Entity.h>
 #include <Render/Transform.h>
 #include <Utils/Time.h>
@@ -21,8 +22,9 @@ bool MovementComponent::init() {
         return false;
     }
     _animator = _entity->getComponent<Animator>();
-    _speed = _data->getData<float>("speed", 4.0f);
-    _animations = _data->getArray<std::string,4>("animations");
+    const Data& data = _data->get<Data>();
+    _speed = data.speed;
+    std::ranges::copy(data.animations, _animations.begin());
     return true;
 }
 
@@ -37,7 +39,7 @@ bool MovementComponent::update() {
     }
     if (_pathIndex >= _path.size()) {
         _path.clear();
-        if (_animator) _animator->changeAnimation(std::string());
+        if (_animator) _animator->changeAnimation(Symbol());
         return true;
     }
     Vector2 currentPosition = _transform->getGlobalPosition();
@@ -58,13 +60,13 @@ bool MovementComponent::update() {
     } else {
         _transform->move(movement);
         if (_animator) {
-            std::string newAnimation;
+            size_t newAnimation;
             if (std::abs(direction.getX()) > std::abs(direction.getY())) {
-                newAnimation = direction.getX() > 0 ? _animations[3] : _animations[2];
+                newAnimation = direction.getX() > 0 ? 3 : 2;
             } else {
-                newAnimation = direction.getY() > 0 ? _animations[1] : _animations[0];
+                newAnimation = direction.getY() > 0 ? 1 : 0;
             }
-            _animator->changeAnimation(newAnimation);
+            _animator->changeAnimation(_animations[newAnimation]);
         }
     }
     return true;
@@ -75,3 +77,8 @@ void MovementComponent::RegisterToLua(sol::state& lua) {
     type["setTarget"] = &MovementComponent::setTarget;
     type["get"] = MovementComponent::get;
 }
+
+void MovementComponent::DeclareSchema(ComponentSchemaTemplate<Data>& schema) {
+    schema.field("speed", &Data::speed, 4.0f)
+        .field("animations", &Data::animations);
+}
@@ -4,18 +4,24 @@
 #include "MovementObstacle.h"
 #include <string>
 #include <array>
+#include <Utils/Symbol.h>
 
 class Animator;
 
 class ComponentDerived(MovementComponent, MovementObstacle) {
   private:
   std::vector<Vector2> _path;
-  std::array<std::string, 4> _animations;
+  std::array<Symbol, 4> _animations;
   float _speed;
   int _pathIndex;
   Animator* _animator;
   public:
+  struct Data : ComponentFields {
+      float speed;
+      std::array<std::string, 4> animations;
+  };
   MovementComponent(ComponentData const* data);
+  static void DeclareSchema(ComponentSchemaTemplate<Data>& schema);
   bool init() override;
   bool update() override;
   void setTarget(const Vector2& target);
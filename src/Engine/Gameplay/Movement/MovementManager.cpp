@@ -12,8 +12,9 @@ MovementManager::MovementManager(ComponentData const *data) :
 }
 
 bool MovementManager::init() {
-    _tileWidth = _data->getData<float>("tileWidth",1);
-    _tileHeight = _data->getData<float>("tileHeight",1);;
+    const Data& data = _data->get<Data>();
+    _tileWidth = data.tileWidth;
+    _tileHeight = data.tileHeight;
     return true;
 }
 
@@ -114,3 +115,8 @@ std::optional<Vector2> MovementManager::findNearestFreeCell(const Vector2& cente
     }
     return std::nullopt;
 }
+
+void MovementManager::DeclareSchema(ComponentSchemaTemplate<Data>& schema) {
+    schema.field("tileWidth", &Data::tileWidth, 1)
+        .field("tileHeight", &Data::tileHeight, 1);
+}
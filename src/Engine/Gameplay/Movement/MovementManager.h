@@ -11,7 +11,12 @@ class ComponentClass(MovementManager) {
     float _tileWidth, _tileHeight;
     std::unordered_set<Vector2> _occupiedPositions;
     public:
+    struct Data : ComponentFields {
+        float tileWidth;
+        float tileHeight;
+    };
     explicit MovementManager(ComponentData const *data);
+    static void DeclareSchema(ComponentSchemaTemplate<Data>& schema);
     bool init() override;
     std::unordered_set<Vector2>::iterator registerObstacle(const Vector2 &position);
     void unregisterObstacle(std::unordered_set<Vector2>::iterator iter);
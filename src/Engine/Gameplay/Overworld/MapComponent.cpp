@@ -14,7 +14,7 @@ MapComponent::MapComponent(const ComponentData *data) :
 }
 
 bool MapComponent::init() {
-    _adjacentMaps = _data->getSet("adjacentMaps");
+    _adjacentMaps = _data->get<Data>().adjacentMaps;
     _collider = _entity->getComponent<Collider>();
     if (_collider == nullptr) {
         Error::ShowError("Map object sin Collider", "Todos los Mapas requieren de un componente Collider para funcionar");
@@ -45,3 +45,7 @@ bool MapComponent::update() {
 const std::unordered_set<std::string>& MapComponent::getAdjacentMaps() const {
     return _adjacentMaps;
 }
+
+void MapComponent::DeclareSchema(ComponentSchemaTemplate<Data>& schema) {
+    schema.field("adjacentMaps", &Data::adjacentMaps);
+}
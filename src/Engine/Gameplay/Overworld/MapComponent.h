@@ -14,7 +14,11 @@ class ComponentClass(MapComponent) {
         Collider* _collider;
         Collider* _player;
     public:
+        struct Data : ComponentFields {
+            std::unordered_set<std::string> adjacentMaps;
+        };
         MapComponent(const ComponentData* data);
+        static void DeclareSchema(ComponentSchemaTemplate<Data>& schema);
         bool init() override;
         bool update() override;
         const std::unordered_set<std::string>& getAdjacentMaps() const;
@@ -6,16 +6,17 @@
 #include <Core/ComponentData.h>
 #include <Core/Entity.h>
 #include <Core/Game.h>
+#include <Core/Scene.h>
 #include <Utils/Error.h>
 
 
-Entity* OverworldManager::addMap(const std::string &mapName) {
+EntityHandle OverworldManager::addMap(const std::string &mapName) {
     std::string path = "data/prefabs/" + mapName + ".lua";
-    if (Entity* map = _game->instantiatePrefab(path)) {
+    EntityHandle map = _game->instantiatePrefab(path);
+    if (map.getScene() != nullptr) {
         _loadedMaps.insert({mapName, map});
-        return map;
     }
-    return nullptr;
+    return map;
 }
 
 OverworldManager::OverworldManager(const ComponentData *data) : ComponentTemplate(data) {
@@ -23,8 +24,8 @@ OverworldManager::OverworldManager(const ComponentData *data) : ComponentTemplat
 
 
 bool OverworldManager::init() {
-    std::string startingMap = _data->getData<std::string>("startingMap");
-    Entity* map = addMap(startingMap);
+    const std::string& startingMap = _data->get<Data>().startingMap;
+    Entity* map = _scene->getEntity(addMap(startingMap));
     if (!map) {
         Error::ShowError("Fallo al cargar el mapa " + startingMap, "No se encontro prefab para el mapa " + startingMap);
         return false;
@@ -39,8 +40,12 @@ bool OverworldManager::init() {
 
 bool OverworldManager::changeMap(std::unordered_set<std::string> adjacent) {
     for (auto iter = _loadedMaps.begin(); iter != _loadedMaps.end();) {
-        if (!adjacent.contains(iter->first)) {
-            iter->second->setActive(false);
+        Entity* map = _scene->getEntity(iter->second);
+        if (map == nullptr) {
+            iter = _loadedMaps.erase(iter);
+        }
+        else if (!adjacent.contains(iter->first)) {
+            _scene->setEntityActive(map, false);
             _unloadedMaps.insert(std::move(*iter));
             iter = _loadedMaps.erase(iter);
         }
@@ -50,13 +55,18 @@ bool OverworldManager::changeMap(std::unordered_set<std::string> adjacent) {
         }
     }
     for (const std::string& mapName : adjacent) {
-        if (auto mapIter = _unloadedMaps.find(mapName); mapIter != _unloadedMaps.end()) {
-            mapIter->second->setActive(true);
+        auto mapIter = _unloadedMaps.find(mapName);
+        Entity* map = mapIter != _unloadedMaps.end() ? _scene->getEntity(mapIter->second) : nullptr;
+        if (map != nullptr) {
+            _scene->setEntityActive(map, true);
             _loadedMaps.insert(std::move(*mapIter));
             _unloadedMaps.erase(mapIter);
         }
         else {
-            if (!addMap(mapName)) {
+            if (mapIter != _unloadedMaps.end()) {
+                _unloadedMaps.erase(mapIter);
+            }
+            if (addMap(mapName).getScene() == nullptr) {
                 Error::ShowError("Fallo al cargar el mapa " + mapName, "No se encontro prefab para el mapa " + mapName);
                 return false;
             }
@@ -65,3 +75,7 @@ bool OverworldManager::changeMap(std::unordered_set<std::string> adjacent) {
     }
     return true;
 }
+
+void OverworldManager::DeclareSchema(ComponentSchemaTemplate<Data>& schema) {
+    schema.field("startingMap", &Data::startingMap);
+}
@@ -1,6 +1,7 @@
 #ifndef OVERWORLDMANAGER_H
 #define OVERWORLDMANAGER_H
 #include <Core/ComponentTemplate.h>
+#include <Core/EntityHandle.h>
 #include <unordered_map>
 #include <unordered_set>
 #include <string>
@@ -10,11 +11,15 @@ class MapComponent;
 
 class ComponentClass(OverworldManager) {
 	private:
-		std::unordered_map<std::string, Entity*> _loadedMaps;
-		std::unordered_map<std::string, Entity*> _unloadedMaps;
-		Entity* addMap(const std::string& mapName);
+		std::unordered_map<std::string, EntityHandle> _loadedMaps;
+		std::unordered_map<std::string, EntityHandle> _unloadedMaps;
+		EntityHandle addMap(const std::string& mapName);
     public:
+		struct Data : ComponentFields {
+			std::string startingMap;
+		};
     	OverworldManager(const ComponentData* data);
+		static void DeclareSchema(ComponentSchemaTemplate<Data>& schema);
 		bool init() override;
 		bool changeMap(std::unordered_set<std::string> adjacent);
 };
@@ -24,9 +24,10 @@ bool Button::init() {
         Error::ShowError("Button object sin camara en escena", "Todos los botones requieren de un componente Camera en escena");
         return false;
     }
-    _callback = _data->getData<sol::function>("callback");
-    _params = _data->getData<sol::table>("params");
-    _size = _data->getVector("size", Vector2::UNIT);
+    const Data& data = _data->get<Data>();
+    _callback = data.callback;
+    _params = data.params;
+    _size = data.size;
     return true;
 }
 
@@ -60,4 +61,8 @@ void Button::RegisterToLua(sol::state& lua) {
     type["get"] = &Button::get;
 }
 
-
+void Button::DeclareSchema(ComponentSchemaTemplate<Data>& schema) {
+    schema.field("callback", &Data::callback)
+        .field("params", &Data::params)
+        .field("size", &Data::size, Vector2::UNIT);
+}
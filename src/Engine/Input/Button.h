@@ -19,7 +19,13 @@ class ComponentClass(Button) {
         Camera* _camera;
 
     public:
+    struct Data : ComponentFields {
+        sol::function callback;
+        sol::table params;
+        Vector2 size;
+    };
     Button(ComponentData const* data);
+    static void DeclareSchema(ComponentSchemaTemplate<Data>& schema);
     bool init() override;
     bool update() override;
     void setCallback(const sol::function &callback);
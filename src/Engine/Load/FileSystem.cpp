@@ -0,0 +1,236 @@
+#include "FileSystem.h"
+
+#include <algorithm>
+#include <cstring>
+#include <Utils/Error.h>
+#include <SDL3/SDL.h>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#if defined(__ANDROID__)
+#include <android/asset_manager.h>
+#include <android/asset_manager_jni.h>
+#include <jni.h>
+#else
+#include <fcntl.h>
+#include <sys/stat.h>
+#endif
+#endif
+
+#ifdef __APPLE__
+#define GetCurrentDir strdup(SDL_GetBasePath())
+#else
+#define GetCurrentDir SDL_GetCurrentDirectory()
+#endif
+
+const char* FileSystem::_archive = nullptr;
+uint64_t FileSystem::_archiveSize = 0;
+void* FileSystem::_mapping = nullptr;
+uint64_t FileSystem::_mappingSize = 0;
+const PakEntry* FileSystem::_entries = nullptr;
+uint32_t FileSystem::_entryCount = 0;
+const char* FileSystem::_names = nullptr;
+
+std::string FileSystem::GetPath(std::string const& path) {
+    std::string filepath = path;
+    std::ranges::replace(filepath, '\\', '/');
+#ifdef __APPLE__
+    auto currDir = GetCurrentDir;
+    filepath = currDir + filepath;
+    SDL_free(currDir);
+#endif
+    return filepath;
+}
+
+bool FileSystem::MapArchive(std::string const& path) {
+    std::string filepath = GetPath(path);
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file != INVALID_HANDLE_VALUE) {
+        LARGE_INTEGER size;
+        HANDLE mapping = GetFileSizeEx(file, &size) && size.QuadPart > 0
+            ? CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr) : nullptr;
+        void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+        if (mapping)
+            CloseHandle(mapping);
+        CloseHandle(file);
+        if (view) {
+            _archive = static_cast<const char*>(view);
+            _archiveSize = size.QuadPart;
+            _mapping = view;
+            _mappingSize = _archiveSize;
+            return true;
+        }
+    }
+#elif defined(__ANDROID__)
+    auto* env = static_cast<JNIEnv*>(SDL_GetAndroidJNIEnv());
+    auto activity = static_cast<jobject>(SDL_GetAndroidActivity());
+    jobject assets = nullptr;
+    if (env && activity) {
+        jclass activityClass = env->GetObjectClass(activity);
+        jmethodID getAssets = env->GetMethodID(activityClass, "getAssets", "()Landroid/content/res/AssetManager;");
+        assets = getAssets ? env->CallObjectMethod(activity, getAssets) : nullptr;
+        env->DeleteLocalRef(activityClass);
+        env->DeleteLocalRef(activity);
+    }
+    AAssetManager* manager = assets ? AAssetManager_fromJava(env, assets) : nullptr;
+    AAsset* asset = manager ? AAssetManager_open(manager, filepath.c_str(), AASSET_MODE_RANDOM) : nullptr;
+    off64_t start = 0, length = 0;
+    int file = asset ? AAsset_openFileDescriptor64(asset, &start, &length) : -1;
+    if (asset)
+        AAsset_close(asset);
+    if (assets)
+        env->DeleteLocalRef(assets);
+    if (file >= 0) {
+        off64_t base = start - start % sysconf(_SC_PAGESIZE);
+        uint64_t size = length + (start - base);
+        void* view = length > 0 ? mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, base) : MAP_FAILED;
+        close(file);
+        if (view != MAP_FAILED) {
+            _archive = static_cast<const char*>(view) + (start - base);
+            _archiveSize = length;
+            _mapping = view;
+            _mappingSize = size;
+            return true;
+        }
+    }
+#else
+    int file = open(filepath.c_str(), O_RDONLY);
+    if (file >= 0) {
+        struct stat info {};
+        void* view = fstat(file, &info) == 0 && info.st_size > 0
+            ? mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, file, 0) : MAP_FAILED;
+        close(file);
+        if (view != MAP_FAILED) {
+            _archive = static_cast<const char*>(view);
+            _archiveSize = info.st_size;
+            _mapping = view;
+            _mappingSize = _archiveSize;
+            return true;
+        }
+    }
+#endif
+    size_t size = 0;
+    void* content = SDL_LoadFile(filepath.c_str(), &size);
+    if (!content)
+        return false;
+    _archive = static_cast<const char*>(content);
+    _archiveSize = size;
+    return true;
+}
+
+bool FileSystem::ValidateArchive() {
+    if (_archiveSize < sizeof(PakHeader))
+        return false;
+    PakHeader header;
+    std::memcpy(&header, _archive, sizeof(PakHeader));
+    if (std::memcmp(header.magic, PakMagic, sizeof(PakMagic)) != 0 || header.version != PakVersion)
+        return false;
+    uint64_t namesOffset = sizeof(PakHeader) + static_cast<uint64_t>(header.entryCount) * sizeof(PakEntry);
+    if (namesOffset + header.namesSize > _archiveSize)
+        return false;
+    _entries = reinterpret_cast<const PakEntry*>(_archive + sizeof(PakHeader));
+    _entryCount = header.entryCount;
+    _names = _archive + namesOffset;
+    for (uint32_t i = 0; i < _entryCount; ++i) {
+        const PakEntry& entry = _entries[i];
+        if (entry.compression != PakCompression::NONE || entry.storedSize != entry.size ||
+            entry.offset > _archiveSize || entry.storedSize > _archiveSize - entry.offset ||
+            static_cast<uint64_t>(entry.nameOffset) + entry.nameSize > header.namesSize)
+            return false;
+    }
+    return true;
+}
+
+const PakEntry* FileSystem::Find(std::string_view path) {
+    if (_entryCount == 0)
+        return nullptr;
+    std::string normalized;
+    if (path.find('\\') != std::string_view::npos) {
+        normalized = path;
+        std::ranges::replace(normalized, '\\', '/');
+        path = normalized;
+    }
+    auto nameOf = [](PakEntry const& entry) {
+        return std::string_view(_names + entry.nameOffset, entry.nameSize);
+    };
+    const PakEntry* end = _entries + _entryCount;
+    const PakEntry* entry = std::lower_bound(_entries, end, path, [&](PakEntry const& entry, std::string_view name) {
+        return nameOf(entry) < name;
+    });
+    if (entry == end || nameOf(*entry) != path)
+        return nullptr;
+    return entry;
+}
+
+bool FileSystem::Mount(std::string const& archive) {
+    Unmount();
+    if (!MapArchive(archive))
+        return false;
+    if (!ValidateArchive()) {
+        Error::ShowError("Error al montar el archivo de datos", "El archivo " + archive + " no es un pak válido, se usarán los archivos sueltos.");
+        Unmount();
+        return false;
+    }
+    return true;
+}
+
+void FileSystem::Unmount() {
+    if (_mapping) {
+#if defined(_WIN32)
+        UnmapViewOfFile(_mapping);
+#else
+        munmap(_mapping, _mappingSize);
+#endif
+    }
+    else if (_archive) {
+        SDL_free(const_cast<char*>(_archive));
+    }
+    _archive = nullptr;
+    _archiveSize = 0;
+    _mapping = nullptr;
+    _mappingSize = 0;
+    _entries = nullptr;
+    _entryCount = 0;
+    _names = nullptr;
+}
+
+bool FileSystem::Read(std::string const& path, std::span<const char>& data, std::vector<char>& buffer) {
+    if (const PakEntry* entry = Find(path)) {
+        data = std::span(_archive + entry->offset, entry->size);
+        return true;
+    }
+
+    SDL_IOStream* file = SDL_IOFromFile(GetPath(path).c_str(), "rb");
+    if (!file) {
+        Error::ShowError("Error al abrir el archivo", "Error al abrir el archivo: " + path + " - " + SDL_GetError());
+        return false;
+    }
+
+    Sint64 fileSize = SDL_GetIOSize(file);
+    if (fileSize <= 0) {
+        Error::ShowError("Error al obtener el tamaño del archivo", "Error al obtener el tamaño del archivo: " + path + " - " + SDL_GetError());
+        SDL_CloseIO(file);
+        return false;
+    }
+
+    buffer.resize(fileSize);
+    if (SDL_ReadIO(file, buffer.data(), buffer.size()) != buffer.size()) {
+        Error::ShowError("Error al leer el archivo", "Error al leer el archivo: " + path + " - " + SDL_GetError());
+        SDL_CloseIO(file);
+        return false;
+    }
+    SDL_CloseIO(file);
+    data = buffer;
+    return true;
+}
+
+SDL_IOStream* FileSystem::Open(std::string const& path) {
+    if (const PakEntry* entry = Find(path))
+        return SDL_IOFromConstMem(_archive + entry->offset, entry->size);
+    return SDL_IOFromFile(GetPath(path).c_str(), "rb");
+}
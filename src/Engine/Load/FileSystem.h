@@ -0,0 +1,117 @@
+#ifndef FILESYSTEM_H
+#define FILESYSTEM_H
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "PakFormat.h"
+
+struct SDL_IOStream;
+
+/// @~english
+/// @brief Virtual file system that serves game files from a memory-mapped pak archive, falling back to loose files when they aren't packed.
+/// @~spanish
+/// @brief Sistema de archivos virtual que sirve los archivos del juego desde un archivo pak mapeado en memoria, recurriendo a archivos sueltos cuando no están empaquetados.
+class FileSystem {
+private:
+    static const char* _archive;
+    static uint64_t _archiveSize;
+    static void* _mapping;
+    static uint64_t _mappingSize;
+    static const PakEntry* _entries;
+    static uint32_t _entryCount;
+    static const char* _names;
+
+    /// @~english
+    /// @brief Gets the path of a loose file as the platform expects it, with every separator as a forward slash.
+    /// @param path Relative path from the executable to the file.
+    /// @return Path to open the file with.
+    /// @~spanish
+    /// @brief Obtiene la ruta de un archivo suelto tal y como la espera la plataforma, con todos los separadores como barras normales.
+    /// @param path Ruta relativa desde el ejecutable hasta el archivo.
+    /// @return Ruta con la que abrir el archivo.
+    static std::string GetPath(std::string const& path);
+
+    /// @~english
+    /// @brief Maps the whole archive into memory, or reads it when the platform can't map it.
+    /// @remarks On Android the archive is mapped from inside the APK, so it must be stored there without compression.
+    /// @param path Relative path from the executable to the archive.
+    /// @return \c true if the archive is in memory. \c false if it couldn't be opened.
+    /// @~spanish
+    /// @brief Mapea el archivo completo en memoria, o lo lee cuando la plataforma no puede mapearlo.
+    /// @remarks En Android el archivo se mapea desde dentro del APK, por lo que debe almacenarse allí sin comprimir.
+    /// @param path Ruta relativa desde el ejecutable hasta el archivo.
+    /// @return \c true si el archivo está en memoria. \c false si no se pudo abrir.
+    static bool MapArchive(std::string const& path);
+
+    /// @~english
+    /// @brief Checks that the directory of the archive in memory is valid.
+    /// @return \c true if every entry lies inside the archive and can be read. \c false otherwise.
+    /// @~spanish
+    /// @brief Comprueba que el directorio del archivo en memoria es válido.
+    /// @return \c true si todas las entradas están dentro del archivo y pueden leerse. \c false en caso contrario.
+    static bool ValidateArchive();
+
+    /// @~english
+    /// @brief Looks for a file in the directory of the mounted archive.
+    /// @remarks Backslashes in the path are taken as forward slashes, like the names stored in the archive.
+    /// @param path Relative path from the executable to the file.
+    /// @return A pointer to the entry of the file. \c nullptr if it isn't packed.
+    /// @~spanish
+    /// @brief Busca un archivo en el directorio del archivo montado.
+    /// @remarks Las barras invertidas de la ruta se toman como barras normales, como los nombres almacenados en el archivo.
+    /// @param path Ruta relativa desde el ejecutable hasta el archivo.
+    /// @return Un puntero a la entrada del archivo. \c nullptr si no está empaquetado.
+    static const PakEntry* Find(std::string_view path);
+
+public:
+    /// @~english
+    /// @brief Mounts a pak archive so its files are served from memory.
+    /// @param archive Relative path from the executable to the archive.
+    /// @return \c true if the archive was mounted. \c false if it doesn't exist or isn't valid, in which case only loose files are used.
+    /// @~spanish
+    /// @brief Monta un archivo pak para que sus archivos se sirvan desde memoria.
+    /// @param archive Ruta relativa desde el ejecutable hasta el archivo.
+    /// @return \c true si se montó el archivo. \c false si no existe o no es válido, en cuyo caso solo se usan archivos sueltos.
+    static bool Mount(std::string const& archive);
+
+    /// @~english
+    /// @brief Releases the mounted archive. Every span and stream given before becomes invalid.
+    /// @~spanish
+    /// @brief Libera el archivo montado. Todos los fragmentos y flujos dados antes dejan de ser válidos.
+    static void Unmount();
+
+    /// @~english
+    /// @brief Reads the whole content of a file.
+    /// @remarks Packed files are given without copying. Loose files are read into the buffer.
+    /// @param path Relative path from the executable to the file.
+    /// @param data Out parameter to store the content of the file.
+    /// @param buffer Storage used when the file has to be read from disk.
+    /// @return \c true on successful reading. \c false on failure.
+    /// @~spanish
+    /// @brief Lee el contenido completo de un archivo.
+    /// @remarks Los archivos empaquetados se dan sin copiarse. Los archivos sueltos se leen en el búfer.
+    /// @param path Ruta relativa desde el ejecutable hasta el archivo.
+    /// @param data Parámetro de salida para almacenar el contenido del archivo.
+    /// @param buffer Almacenamiento usado cuando el archivo tiene que leerse del disco.
+    /// @return \c true si la lectura es exitosa. \c false si falla.
+    static bool Read(std::string const& path, std::span<const char>& data, std::vector<char>& buffer);
+
+    /// @~english
+    /// @brief Opens a read-only stream to a file.
+    /// @remarks It doesn't show errors, so it can be used from worker threads.
+    /// @param path Relative path from the executable to the file.
+    /// @return A stream that must be closed by the caller. \c nullptr if the file couldn't be opened.
+    /// @~spanish
+    /// @brief Abre un flujo de solo lectura a un archivo.
+    /// @remarks No muestra errores, por lo que puede usarse desde hilos trabajadores.
+    /// @param path Ruta relativa desde el ejecutable hasta el archivo.
+    /// @return Un flujo que debe cerrar quien lo llama. \c nullptr si no se pudo abrir el archivo.
+    static SDL_IOStream* Open(std::string const& path);
+};
+
+
+#endif //FILESYSTEM_H
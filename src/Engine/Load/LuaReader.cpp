@@ -18,17 +18,16 @@
 #include <Render/Text.h>
 #include <Render/Transform.h>
 #include <Utils/Error.h>
+#include <Utils/Symbol.h>
 
-#ifdef __APPLE__
-#define GetCurrentDir strdup(SDL_GetBasePath())
-#else
-#define GetCurrentDir SDL_GetCurrentDirectory()
-#endif
+#include "FileSystem.h"
+#include "ResourceManager.h"
 
 LuaReader* LuaReader::_instance = nullptr;
 
 void LuaReader::registerUserTypes() {
     Vector2::RegisterToLua(_lua);
+    Symbol::RegisterToLua(_lua);
 
     EventBehaviour::RegisterToLua(_lua);
     EventCondition::RegisterToLua(_lua);
@@ -57,53 +56,59 @@ bool LuaReader::init() {
         std::string filename = module;
         std::ranges::replace(filename, '.', '/');
         filename += ".lua";
-        std::string fileContent;
-        if (!ReadFile(filename, fileContent))
+        sol::protected_function chunk = _instance->getChunk(filename);
+        if (!chunk.valid())
             return sol::make_object(_lua, ("\n\tno bindings module " + module));
-        return _instance->_lua.load(fileContent).get<sol::object>();
+        return sol::make_object(_lua, chunk);
     });
     registerUserTypes();
     return true;
 }
 
-LuaReader::LuaReader() = default;
-
-bool LuaReader::ReadFile(const std::string& filename, std::string& fileContent) {
-#ifdef __APPLE__
-    auto currDir = GetCurrentDir;
-    std::string filepath = currDir + filename;
-    SDL_free(currDir);
-#else
-    std::string filepath = filename;
-#endif
-
-    SDL_IOStream* file = SDL_IOFromFile(filepath.c_str(), "r");
-    if (!file) {
-        Error::ShowError("Error al abrir el archivo", "Error al abrir el archivo: " + filename + " - " + SDL_GetError());
-        return false;
-    }
-
-    int fileSize = static_cast<int>(SDL_GetIOSize(file));
-    if (fileSize <= 0) {
-        Error::ShowError("Error al obtener el tamaño del archivo", "Error al obtener el tamaño del archivo: " + filename + " - " + SDL_GetError());
-        SDL_CloseIO(file);
-        return false;
-    }
+LuaReader::LuaReader() : _chunksSize(0) {
+}
 
-    char* fileData = new char[fileSize + 1];  // +1 para el null terminator
-    if (SDL_ReadIO(file, fileData, fileSize) != fileSize) {
-        Error::ShowError("Error al leer el archivo", "Error al leer el archivo: " + filename + " - " + SDL_GetError());
-        delete[] fileData;
-        SDL_CloseIO(file);
-        return false;
-    }
-    fileData[fileSize] = '\0';
+LuaReader::~LuaReader() {
+    while (!_chunks.empty())
+        evictChunk();
+}
 
-    fileContent = fileData;
-    delete[] fileData;
+void LuaReader::evictChunk() {
+    auto it = _chunks.find(_chunksOrder.back());
+    if (it->second.counted)
+        ResourceManager::ReleaseMemory(it->second.size);
+    _chunksSize -= it->second.size;
+    _chunksOrder.pop_back();
+    _chunks.erase(it);
+}
 
-    SDL_CloseIO(file);
-    return true;
+sol::protected_function LuaReader::getChunk(std::string const& path) {
+    if (auto it = _chunks.find(path); it != _chunks.end()) {
+        _chunksOrder.splice(_chunksOrder.begin(), _chunksOrder, it->second.order);
+        return it->second.function;
+    }
+    std::span<const char> fileContent;
+    std::vector<char> buffer;
+    if (!FileSystem::Read(path, fileContent, buffer))
+        return sol::lua_nil;
+    bool precompiled = !fileContent.empty() && fileContent[0] == LUA_SIGNATURE[0];
+    sol::load_result res = _lua.load(std::string_view(fileContent.data(), fileContent.size()), path,
+        precompiled ? sol::load_mode::binary : sol::load_mode::text);
+    if (!res.valid()) {
+        sol::error er = res;
+        Error::ShowError("Error al cargar el script Lua", path + ": " + er.what());
+        return sol::lua_nil;
+    }
+    sol::protected_function chunk = res.get<sol::protected_function>();
+    uint64_t size = fileContent.size();
+    if (size > MAX_CHUNKS_SIZE)
+        return chunk;
+    while (_chunksSize + size > MAX_CHUNKS_SIZE)
+        evictChunk();
+    _chunksOrder.push_front(path);
+    _chunks.emplace(path, Chunk{chunk, size, ResourceManager::ReserveMemory(size), _chunksOrder.begin()});
+    _chunksSize += size;
+    return chunk;
 }
 
 bool LuaReader::Init() {
@@ -120,13 +125,10 @@ void LuaReader::Shutdown() {
 }
 
 sol::table LuaReader::GetTable(std::string const& path) {
-    std::string fileContent;
-    if (!ReadFile(path, fileContent))
-        return sol::lua_nil;
-    sol::load_result res = _instance->_lua.load(fileContent);
-    if (!res.valid())
+    sol::protected_function chunk = _instance->getChunk(path);
+    if (!chunk.valid())
         return sol::lua_nil;
-    sol::protected_function_result res2 = res();
+    sol::protected_function_result res2 = chunk();
     if (!res2.valid()) {
         sol::error er = res2;
         Error::ShowError("GetTable", er.what());
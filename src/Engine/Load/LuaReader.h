@@ -1,19 +1,35 @@
 #ifndef LUAREADER_H
 #define LUAREADER_H
 
+#include <cstdint>
+#include <list>
 #include <string>
+#include <unordered_map>
 #include <sol/sol.hpp>
 
 class LuaReader {
 private:
+    struct Chunk {
+        sol::protected_function function;
+        uint64_t size;
+        bool counted;
+        std::list<std::string>::iterator order;
+    };
+
     static LuaReader* _instance;
+    static constexpr uint64_t MAX_CHUNKS_SIZE = 4 * 1024 * 1024;
     sol::state _lua;
+    std::unordered_map<std::string, Chunk> _chunks;
+    std::list<std::string> _chunksOrder;
+    uint64_t _chunksSize;
 
     void registerUserTypes();
     bool init();
     LuaReader();
+    ~LuaReader();
 
-    static bool ReadFile(const std::string& filename, std::string& fileContent);
+    sol::protected_function getChunk(std::string const& path);
+    void evictChunk();
 
 public:
     /// @~english
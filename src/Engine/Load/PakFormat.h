@@ -0,0 +1,61 @@
+#ifndef PAKFORMAT_H
+#define PAKFORMAT_H
+
+#include <cstdint>
+
+/// @~english
+/// @brief Identifier written at the start of every pak archive.
+/// @~spanish
+/// @brief Identificador escrito al inicio de cada archivo pak.
+static constexpr char PakMagic[4] = {'R', 'P', 'A', 'K'};
+
+/// @~english
+/// @brief Version of the pak layout described in this file.
+/// @~spanish
+/// @brief Versión del formato pak descrito en este archivo.
+static constexpr uint32_t PakVersion = 1;
+
+/// @~english
+/// @brief Alignment in bytes of the data of every entry inside the archive.
+/// @~spanish
+/// @brief Alineamiento en bytes de los datos de cada entrada dentro del archivo.
+static constexpr uint64_t PakAlignment = 64;
+
+/// @~english
+/// @brief Compression applied to the stored data of an entry.
+/// @~spanish
+/// @brief Compresión aplicada a los datos almacenados de una entrada.
+enum class PakCompression : uint32_t {
+    NONE = 0
+};
+
+/// @~english
+/// @brief Header at the start of a pak archive. It's followed by \c entryCount \c PakEntry sorted by name and then by the names of every entry.
+/// @~spanish
+/// @brief Cabecera al inicio de un archivo pak. Le siguen \c entryCount \c PakEntry ordenadas por nombre y después los nombres de cada entrada.
+struct PakHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t entryCount;
+    uint32_t namesSize;
+};
+
+/// @~english
+/// @brief Directory entry of a file stored in a pak archive. Offsets are relative to the start of the archive.
+/// @~spanish
+/// @brief Entrada del directorio de un archivo almacenado en un pak. Los desplazamientos son relativos al inicio del archivo.
+struct PakEntry {
+    uint64_t offset;
+    uint64_t size;
+    uint64_t storedSize;
+    uint32_t nameOffset;
+    uint32_t nameSize;
+    PakCompression compression;
+    uint32_t reserved;
+};
+
+static_assert(sizeof(PakHeader) == 16);
+static_assert(sizeof(PakEntry) == 40);
+
+
+#endif //PAKFORMAT_H
@@ -1,8 +1,21 @@
 #include "Resource.h"
 
 Resource::Resource(std::string const& path) :
-    _size(-1),
+    _generation(0),
+    _touched(false),
+    _state(LoadState::UNLOADED),
+    _references(0),
+    _pins(0),
+    _loadFrame(0),
+    _size(0),
     _path(path){
 }
 
-Resource::~Resource() = default;
\ No newline at end of file
+Resource::~Resource() = default;
+
+void Resource::prepare() {
+}
+
+std::string_view Resource::getBudget() const {
+    return {};
+}
@@ -1,15 +1,32 @@
 #ifndef RESOURCE_H
 #define RESOURCE_H
 
+#include <cstdint>
 #include <string>
+#include <string_view>
+#include <type_traits>
 
 /// @~english
 /// @brief Base interface to implement different types of resources.
 /// @~english
 /// @brief Interfaz base para implementar diferentes tipos de recursos.
 class Resource {
+private:
+    friend class ResourceMemoryManager;
+    friend class ResourceManager;
+    template <typename ResourceType>
+    friend class ResourceHandle;
+    static inline bool _referencesReleased = false;
+    enum class LoadState : uint8_t { UNLOADED, REQUESTED, PREPARED, LOADED };
+    uint32_t _generation;
+    bool _touched;
+    LoadState _state;
+    uint32_t _references;
+    uint32_t _pins;
+    uint64_t _loadFrame;
+
 protected:
-    int _size;
+    uint64_t _size;
     std::string _path;
 
 public:
@@ -27,6 +44,14 @@ public:
     /// @brief Destructor por defecto.
     virtual ~Resource();
 
+    /// @~english
+    /// @brief Does the part of the loading that doesn't need the main thread, like reading and decoding the file.
+    /// @remarks It may be called from a worker thread, so it can't use Lua nor show errors. Whatever it stores must be consumed by \c load or released by \c unload .
+    /// @~spanish
+    /// @brief Realiza la parte de la carga que no necesita el hilo principal, como leer y decodificar el archivo.
+    /// @remarks Puede llamarse desde un hilo trabajador, por lo que no puede usar Lua ni mostrar errores. Lo que almacene debe consumirlo \c load o liberarlo \c unload .
+    virtual void prepare();
+
     /// @~english
     /// @brief Read the file in the specified path and store it.
     /// @return \c true on successful loading. \c false on failure.
@@ -43,12 +68,39 @@ public:
 
     /// @~english
     /// @brief Gets the size of the stored \c Resource memory.
-    /// @return Size in bytes of the stored memory. \c -1 if the \c Resource isn't loaded.
+    /// @return Size in bytes of the stored memory. \c 0 if the \c Resource isn't loaded.
     /// @~spanish
     /// @brief Accede al tamaño de la memoria de \c Resource almacenada.
-    /// @return Tamaño en bytes de la memoria almacenada. \c -1 si el \c Resource no está cargado.
-    inline int getSize() const { return _size; }
+    /// @return Tamaño en bytes de la memoria almacenada. \c 0 si el \c Resource no está cargado.
+    inline uint64_t getSize() const { return _size; }
+
+    /// @~english
+    /// @brief Gets the name of the memory budget the \c Resource counts against, as written in the \c memory.budgets table of \c config.lua .
+    /// @return Name of the budget. An empty name means the \c Resource is only limited by the maximum size.
+    /// @~spanish
+    /// @brief Accede al nombre del presupuesto de memoria al que cuenta el \c Resource , tal y como se escribe en la tabla \c memory.budgets de \c config.lua .
+    /// @return Nombre del presupuesto. Un nombre vacío significa que el \c Resource solo está limitado por el tamaño máximo.
+    virtual std::string_view getBudget() const;
+
+    /// @~english
+    /// @brief Gets the generation of the stored \c Resource memory. It changes every time the \c Resource is loaded or unloaded.
+    /// @return Current generation of the \c Resource.
+    /// @~spanish
+    /// @brief Accede a la generación de la memoria de \c Resource almacenada. Cambia cada vez que el \c Resource se carga o se descarga.
+    /// @return Generación actual del \c Resource.
+    inline uint32_t getGeneration() const { return _generation; }
+
+    /// @~english
+    /// @brief Checks if the \c Resource is loaded and ready to be used.
+    /// @return \c true if the \c Resource is loaded. \c false if it isn't or if it's still being requested.
+    /// @~spanish
+    /// @brief Comprueba si el \c Resource está cargado y listo para usarse.
+    /// @return \c true si el \c Resource está cargado. \c false si no lo está o si aún se está solicitando.
+    inline bool isLoaded() const { return _state == LoadState::LOADED; }
 };
 
+template<typename T>
+concept resourceDerived = std::is_base_of_v<Resource, T>;
+
 
 #endif //RESOURCE_H
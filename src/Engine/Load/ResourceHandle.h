@@ -0,0 +1,233 @@
+#ifndef RESOURCEHANDLE_H
+#define RESOURCEHANDLE_H
+
+#include <cstdint>
+#include <Utils/Symbol.h>
+
+#include "Resource.h"
+
+template <resourceDerived ResourceType>
+class ResourceHandler;
+
+/// @~english
+/// @brief Reference to a resource of a \c ResourceHandler that resolves its key only once.
+/// @details The resolved pointer is reused while the generation of the resource doesn't change, that is, while it isn't unloaded or reloaded.
+/// Once resolved, the handle holds a reference that keeps the resource from being evicted until the handle is reset or destroyed.
+/// @tparam ResourceType Type of the referenced resource, must be a derived class from \c Resource.
+/// @~spanish
+/// @brief Referencia a un recurso de un \c ResourceHandler que resuelve su clave una sola vez.
+/// @details El puntero resuelto se reutiliza mientras la generación del recurso no cambie, es decir, mientras no se descargue ni se vuelva a cargar.
+/// Una vez resuelto, el handle mantiene una referencia que impide que el recurso se desaloje hasta que el handle se reinicie o se destruya.
+/// @tparam ResourceType Tipo del recurso referenciado, debe ser una clase heredada de \c Resource.
+template <typename ResourceType>
+class ResourceHandle {
+private:
+    Symbol _key;
+    ResourceType* _resource;
+    Resource* _reference;
+    uint32_t _generation;
+
+    /// @~english
+    /// @brief Creates a \c ResourceHandle that already references a resource.
+    /// @param key Key of the resource in its \c ResourceHandler.
+    /// @param resource Resource assigned to the key.
+    /// @~spanish
+    /// @brief Crea un \c ResourceHandle que ya referencia a un recurso.
+    /// @param key Clave del recurso en su \c ResourceHandler.
+    /// @param resource Recurso asignado a la clave.
+    inline ResourceHandle(Symbol const& key, ResourceType* resource) : _key(key), _resource(nullptr), _reference(nullptr), _generation(0) {
+        setResource(resource);
+    }
+
+    /// @~english
+    /// @brief Changes the referenced resource, moving the reference held by the handle.
+    /// @param resource New resource to reference.
+    /// @~spanish
+    /// @brief Cambia el recurso referenciado, moviendo la referencia que mantiene el handle.
+    /// @param resource Nuevo recurso a referenciar.
+    inline void setResource(ResourceType* resource) {
+        if (resource == _resource)
+            return;
+        release();
+        _resource = resource;
+        _reference = resource;
+        addReference();
+        if (_resource)
+            _generation = _resource->getGeneration();
+    }
+
+    /// @~english
+    /// @brief Adds the reference of the handle to its resource.
+    /// @~spanish
+    /// @brief Añade la referencia del handle a su recurso.
+    inline void addReference() {
+        if (_reference)
+            ++_reference->_references;
+    }
+
+    /// @~english
+    /// @brief Drops the resource of the handle and its reference. Once the resources are being released, the resource isn't touched.
+    /// @~spanish
+    /// @brief Suelta el recurso del handle y su referencia. Una vez se están liberando los recursos, el recurso no se toca.
+    inline void release() {
+        if (_reference && !Resource::_referencesReleased && _reference->_references > 0)
+            --_reference->_references;
+        _resource = nullptr;
+        _reference = nullptr;
+    }
+
+    template <resourceDerived HandledType>
+    friend class ResourceHandler;
+
+public:
+    /// @~english
+    /// @brief Creates an empty \c ResourceHandle.
+    /// @~spanish
+    /// @brief Crea un \c ResourceHandle vacío.
+    inline ResourceHandle() : _resource(nullptr), _reference(nullptr), _generation(0) {}
+
+    /// @~english
+    /// @brief Creates a \c ResourceHandle that references the resource assigned to the given key.
+    /// @param key Key of the resource in its \c ResourceHandler.
+    /// @~spanish
+    /// @brief Crea un \c ResourceHandle que referencia al recurso asignado a la clave dada.
+    /// @param key Clave del recurso en su \c ResourceHandler.
+    inline explicit ResourceHandle(Symbol const& key) : _key(key), _resource(nullptr), _reference(nullptr), _generation(0) {}
+
+    /// @~english
+    /// @brief Creates a copy of a \c ResourceHandle that holds its own reference.
+    /// @param other Handle to copy.
+    /// @~spanish
+    /// @brief Crea una copia de un \c ResourceHandle que mantiene su propia referencia.
+    /// @param other Handle a copiar.
+    inline ResourceHandle(ResourceHandle const& other) :
+        _key(other._key), _resource(other._resource), _reference(other._reference), _generation(other._generation) {
+        addReference();
+    }
+
+    /// @~english
+    /// @brief Takes the key and the reference of another \c ResourceHandle , leaving it empty.
+    /// @param other Handle to move.
+    /// @~spanish
+    /// @brief Toma la clave y la referencia de otro \c ResourceHandle , dejándolo vacío.
+    /// @param other Handle a mover.
+    inline ResourceHandle(ResourceHandle&& other) noexcept :
+        _key(other._key), _resource(other._resource), _reference(other._reference), _generation(other._generation) {
+        other._key = {};
+        other._resource = nullptr;
+        other._reference = nullptr;
+    }
+
+    /// @~english
+    /// @brief Makes the handle reference the same resource as another one.
+    /// @param other Handle to copy.
+    /// @return This handle.
+    /// @~spanish
+    /// @brief Hace que el handle referencie al mismo recurso que otro.
+    /// @param other Handle a copiar.
+    /// @return Este handle.
+    inline ResourceHandle& operator=(ResourceHandle const& other) {
+        if (this != &other) {
+            release();
+            _key = other._key;
+            _resource = other._resource;
+            _reference = other._reference;
+            _generation = other._generation;
+            addReference();
+        }
+        return *this;
+    }
+
+    /// @~english
+    /// @brief Takes the key and the reference of another \c ResourceHandle , leaving it empty.
+    /// @param other Handle to move.
+    /// @return This handle.
+    /// @~spanish
+    /// @brief Toma la clave y la referencia de otro \c ResourceHandle , dejándolo vacío.
+    /// @param other Handle a mover.
+    /// @return Este handle.
+    inline ResourceHandle& operator=(ResourceHandle&& other) noexcept {
+        if (this != &other) {
+            release();
+            _key = other._key;
+            _resource = other._resource;
+            _reference = other._reference;
+            _generation = other._generation;
+            other._key = {};
+            other._resource = nullptr;
+            other._reference = nullptr;
+        }
+        return *this;
+    }
+
+    /// @~english
+    /// @brief Releases the reference held by the handle.
+    /// @~spanish
+    /// @brief Suelta la referencia que mantiene el handle.
+    inline ~ResourceHandle() {
+        release();
+    }
+
+    /// @~english
+    /// @brief Makes the handle reference the resource assigned to another key.
+    /// @param key Key of the resource in its \c ResourceHandler. An empty key empties the handle.
+    /// @~spanish
+    /// @brief Hace que el handle referencie al recurso asignado a otra clave.
+    /// @param key Clave del recurso en su \c ResourceHandler. Una clave vacía vacía el handle.
+    inline void reset(Symbol const& key = {}) {
+        _key = key;
+        release();
+    }
+
+    /// @~english
+    /// @brief Gets the key of the referenced resource.
+    /// @return Key of the resource.
+    /// @~spanish
+    /// @brief Accede a la clave del recurso referenciado.
+    /// @return Clave del recurso.
+    inline Symbol const& getKey() const { return _key; }
+
+    /// @~english
+    /// @brief Checks if the handle doesn't reference any resource.
+    /// @return \c true if the key is empty. \c false otherwise.
+    /// @~spanish
+    /// @brief Comprueba si el handle no referencia a ningún recurso.
+    /// @return \c true si la clave está vacía. \c false en caso contrario.
+    inline bool empty() const { return _key.empty(); }
+
+    /// @~english
+    /// @brief Checks if the referenced resource can be used without waiting for it to load.
+    /// @return \c true if the resource is loaded. \c false otherwise.
+    /// @~spanish
+    /// @brief Comprueba si el recurso referenciado puede usarse sin esperar a que se cargue.
+    /// @return \c true si el recurso está cargado. \c false en caso contrario.
+    inline bool ready() const {
+        if (_resource && _resource->isLoaded() && _resource->getGeneration() == _generation)
+            return true;
+        return !_key.empty() && ResourceHandler<ResourceType>::Instance()->isLoaded(_key);
+    }
+
+    /// @~english
+    /// @brief Gets the referenced resource, resolving it through its \c ResourceHandler only if it changed since the last call.
+    /// @return A pointer to the resource. \c nullptr if the handle is empty or the resource couldn't be loaded.
+    /// @~spanish
+    /// @brief Accede al recurso referenciado, resolviéndolo a través de su \c ResourceHandler sólo si cambió desde la última llamada.
+    /// @return Un puntero al recurso. \c nullptr si el handle está vacío o no se pudo cargar el recurso.
+    inline ResourceType const* get() {
+        if (_resource && _resource->isLoaded() && _resource->getGeneration() == _generation) {
+            ResourceHandler<ResourceType>::Instance()->touch(_resource);
+            return _resource;
+        }
+        if (_key.empty())
+            return nullptr;
+        ResourceType* resource = ResourceHandler<ResourceType>::Instance()->acquire(_key);
+        if (!resource)
+            return nullptr;
+        setResource(resource);
+        _generation = resource->getGeneration();
+        return resource;
+    }
+};
+
+
+#endif //RESOURCEHANDLE_H
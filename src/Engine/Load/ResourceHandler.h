@@ -2,15 +2,16 @@
 #define RESOURCEHANDLER_H
 
 #include <unordered_map>
+#include <Utils/Symbol.h>
 
 #include "BaseResourceHandler.h"
+#include "Resource.h"
+#include "ResourceHandle.h"
 #include "ResourceManager.h"
 #include "ResourceMemoryManager.h"
 
-class Resource;
-
-template<typename T>
-concept resourceDerived = std::is_base_of_v<Resource, T>;
+template <typename ResourceType>
+class ResourceHandle;
 
 /// @~english
 /// @brief Data structure that handles the references to a specific type of resource and its memory.
@@ -21,7 +22,7 @@ concept resourceDerived = std::is_base_of_v<Resource, T>;
 template <resourceDerived ResourceType>
 class ResourceHandler : public BaseResourceHandler {
 private:
-    std::unordered_map<std::string, ResourceType*> _resources;
+    std::unordered_map<Symbol, ResourceType*> _resources;
     static inline ResourceHandler* _instance = nullptr;
 
     /// @~english
@@ -34,29 +35,42 @@ private:
     /// @reamrks Si un recurso con la clave dada ya existía se devolverá un puntero a ese \c ResourceType y no se creará uno nuevo.
     /// @param key Clave para acceder posteriormente al recurso.
     /// @return Un puntero al recurso asignado a la clave dada.
-    inline ResourceType* add(std::string const& key) {
+    inline ResourceType* add(Symbol const& key) {
         auto [it, inserted] = _resources.insert({key, nullptr});
         if (inserted)
-            it->second = new ResourceType(key);
+            it->second = new ResourceType(key.str());
         return it->second;
     }
 
     /// @~english
-    /// @brief Deletes the resources assigned to the given key and removes it from the handler.
-    /// @remarks If there's no resource assigned to the given key this method will do nothing.
-    /// @param key Key previously used to add a resource.
+    /// @brief Gets the resource linked to a key, loading it if it wasn't.
+    /// @remarks The resource stays in the handler even if it couldn't be loaded, so pointers held by \c ResourceHandle remain valid.
+    /// @param key Key assigned to the wanted \c ResourceType.
+    /// @return A pointer to the resource requested. \c nullptr if the resource couldn't be loaded.
     /// @~spanish
-    /// @brief Elimina (<c>delete</c>) el recurso asignado a la clave dada y lo borra del gestor.
-    /// @remarks Si no hay un recurso asignado a la clave dada este método no hará nada.
-    /// @param key Clave previamente usada para añadir un recurso.
-    inline void remove(std::string const& key) {
-        auto it = _resources.find(key);
-        if (it == _resources.end())
-            return;
-        delete it->second;
-        _resources.erase(key);
+    /// @brief Accede al recurso asignado a una clave, cargándolo si no lo estaba.
+    /// @remarks El recurso se mantiene en el gestor aunque no se haya podido cargar, para que los punteros guardados en \c ResourceHandle sigan siendo válidos.
+    /// @param key Clave asignada al \c ResourceType buscado.
+    /// @return Un puntero al recurso solicitado. \c nullptr si no se pudo cargar el recurso.
+    inline ResourceType* acquire(Symbol const& key) {
+        ResourceType* resource = add(key);
+        if (!_resourceMemoryManager->activateResource(resource))
+            return nullptr;
+        return resource;
+    }
+
+    /// @~english
+    /// @brief Marks an already loaded resource as used in the current frame.
+    /// @param resource Resource previously returned by \c acquire.
+    /// @~spanish
+    /// @brief Marca un recurso ya cargado como usado en el frame actual.
+    /// @param resource Recurso previamente devuelto por \c acquire.
+    inline void touch(ResourceType* resource) {
+        _resourceMemoryManager->touchResource(resource);
     }
 
+    friend class ResourceHandle<ResourceType>;
+
     /// @~english
     /// @brief Creates an empty \c ResourceHandler .
     /// @~spanish
@@ -106,15 +120,67 @@ public:
     /// @brief Accede al recurso asignado a una clave. Lo carga si no lo estaba.
     /// @param key Clave previamente usada para añadir un recurso.
     /// @return Un puntero al recurso solicitado. \c nullptr si no hay ningún recurso guardado con esa clave o si no se pudo cargar el recurso.
-    inline ResourceType const* get(std::string const& key) {
+    inline ResourceType const* get(Symbol const& key) {
+        return acquire(key);
+    }
+
+    /// @~english
+    /// @brief Starts loading the resource linked to a key in the background.
+    /// @remarks Using the returned handle before the resource is ready finishes the load on the calling thread.
+    /// @param key Key assigned to the wanted \c ResourceType.
+    /// @return A handle to the resource requested.
+    /// @~spanish
+    /// @brief Empieza a cargar en segundo plano el recurso asignado a una clave.
+    /// @remarks Usar el manejador devuelto antes de que el recurso esté listo termina la carga en el hilo que lo usa.
+    /// @param key Clave asignada al \c ResourceType buscado.
+    /// @return Un manejador al recurso solicitado.
+    inline ResourceHandle<ResourceType> request(Symbol const& key) {
+        if (key.empty())
+            return ResourceHandle<ResourceType>();
         ResourceType* resource = add(key);
-        if (!_resourceMemoryManager->activateResource(resource)) {
-            remove(key);
-            return nullptr;
-        }
+        _resourceMemoryManager->requestResource(resource);
+        return ResourceHandle<ResourceType>(key, resource);
+    }
+
+    /// @~english
+    /// @brief Loads the resource linked to a key and keeps it from being evicted until it's unpinned.
+    /// @param key Key assigned to the wanted \c ResourceType.
+    /// @return A pointer to the resource pinned. \c nullptr if the resource couldn't be loaded.
+    /// @~spanish
+    /// @brief Carga el recurso asignado a una clave y evita que se desaloje hasta que se desfije.
+    /// @param key Clave asignada al \c ResourceType buscado.
+    /// @return Un puntero al recurso fijado. \c nullptr si no se pudo cargar el recurso.
+    inline ResourceType const* pin(Symbol const& key) {
+        ResourceType* resource = acquire(key);
+        if (resource)
+            _resourceMemoryManager->pinResource(resource);
         return resource;
     }
 
+    /// @~english
+    /// @brief Undoes a previous \c pin of the resource linked to a key.
+    /// @param key Key assigned to the wanted \c ResourceType.
+    /// @~spanish
+    /// @brief Deshace un \c pin previo del recurso asignado a una clave.
+    /// @param key Clave asignada al \c ResourceType buscado.
+    inline void unpin(Symbol const& key) {
+        if (auto it = _resources.find(key); it != _resources.end())
+            _resourceMemoryManager->unpinResource(it->second);
+    }
+
+    /// @~english
+    /// @brief Checks if the resource linked to a key is loaded.
+    /// @param key Key assigned to the wanted \c ResourceType.
+    /// @return \c true if the resource is loaded. \c false if it isn't or if it's still being requested.
+    /// @~spanish
+    /// @brief Comprueba si el recurso asignado a una clave está cargado.
+    /// @param key Clave asignada al \c ResourceType buscado.
+    /// @return \c true si el recurso está cargado. \c false si no lo está o si aún se está solicitando.
+    inline bool isLoaded(Symbol const& key) const {
+        auto it = _resources.find(key);
+        return it != _resources.end() && it->second->isLoaded();
+    }
+
     /// @~english
     /// @brief Frees the memory of every resource and erases them from the handler.
     /// @~spanish
@@ -0,0 +1,83 @@
+#include "ResourceLoader.h"
+
+#include <algorithm>
+
+#include "Resource.h"
+
+void ResourceLoader::work() {
+    std::unique_lock lock(_mutex);
+    while (true) {
+        _workAvailable.wait(lock, [this] { return _stopping || !_queued.empty(); });
+        if (_stopping)
+            return;
+        Resource* resource = _queued.front();
+        _queued.pop_front();
+        lock.unlock();
+        resource->prepare();
+        lock.lock();
+        _finished.push_back(resource);
+        _jobFinished.notify_all();
+    }
+}
+
+bool ResourceLoader::take(Resource* resource, bool prepareQueued) {
+    std::unique_lock lock(_mutex);
+    if (auto it = std::ranges::find(_queued, resource); it != _queued.end()) {
+        _queued.erase(it);
+        lock.unlock();
+        if (prepareQueued)
+            resource->prepare();
+        return prepareQueued;
+    }
+    _jobFinished.wait(lock, [this, resource] { return std::ranges::find(_finished, resource) != _finished.end(); });
+    std::erase(_finished, resource);
+    return true;
+}
+
+ResourceLoader::ResourceLoader(unsigned threads) :
+    _stopping(false) {
+    _workers.reserve(threads);
+    for (unsigned i = 0; i < threads; ++i)
+        _workers.emplace_back(&ResourceLoader::work, this);
+}
+
+ResourceLoader::~ResourceLoader() {
+    {
+        std::lock_guard lock(_mutex);
+        _stopping = true;
+    }
+    _workAvailable.notify_all();
+    for (std::thread& worker : _workers)
+        worker.join();
+}
+
+void ResourceLoader::submit(Resource* resource) {
+    if (_workers.empty()) {
+        resource->prepare();
+        std::lock_guard lock(_mutex);
+        _finished.push_back(resource);
+        return;
+    }
+    {
+        std::lock_guard lock(_mutex);
+        _queued.push_back(resource);
+    }
+    _workAvailable.notify_one();
+}
+
+bool ResourceLoader::poll(Resource*& resource) {
+    std::lock_guard lock(_mutex);
+    if (_finished.empty())
+        return false;
+    resource = _finished.front();
+    _finished.erase(_finished.begin());
+    return true;
+}
+
+void ResourceLoader::wait(Resource* resource) {
+    take(resource, true);
+}
+
+bool ResourceLoader::cancel(Resource* resource) {
+    return take(resource, false);
+}
@@ -0,0 +1,99 @@
+#ifndef RESOURCELOADER_H
+#define RESOURCELOADER_H
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class Resource;
+
+/// @~english
+/// @brief Pool of worker threads that prepare requested resources in the background.
+/// @remarks Only \c Resource::prepare runs on the workers. Prepared resources wait in the loader until the main thread takes them.
+/// @~spanish
+/// @brief Conjunto de hilos trabajadores que preparan en segundo plano los recursos solicitados.
+/// @remarks Solo \c Resource::prepare se ejecuta en los trabajadores. Los recursos preparados esperan en el cargador hasta que el hilo principal los recoge.
+class ResourceLoader {
+private:
+    std::vector<std::thread> _workers;
+    std::mutex _mutex;
+    std::condition_variable _workAvailable;
+    std::condition_variable _jobFinished;
+    std::deque<Resource*> _queued;
+    std::vector<Resource*> _finished;
+    bool _stopping;
+
+    /// @~english
+    /// @brief Loop run by every worker thread until the loader stops.
+    /// @~spanish
+    /// @brief Bucle que ejecuta cada hilo trabajador hasta que el cargador se detiene.
+    void work();
+
+    /// @~english
+    /// @brief Takes a submitted resource out of the loader, waiting for its worker if it's being prepared.
+    /// @param resource Resource previously submitted.
+    /// @param prepareQueued Whether to prepare on the calling thread a resource that no worker had started.
+    /// @return \c true if the resource has been prepared. \c false otherwise.
+    /// @~spanish
+    /// @brief Saca un recurso enviado del cargador, esperando a su trabajador si se está preparando.
+    /// @param resource Recurso enviado previamente.
+    /// @param prepareQueued Si se debe preparar en el hilo que llama un recurso que ningún trabajador había empezado.
+    /// @return \c true si el recurso se ha preparado. \c false en caso contrario.
+    bool take(Resource* resource, bool prepareQueued);
+
+public:
+    /// @~english
+    /// @brief Creates the loader and starts its workers.
+    /// @param threads Number of worker threads. With \c 0 resources are prepared when submitted.
+    /// @~spanish
+    /// @brief Crea el cargador e inicia sus trabajadores.
+    /// @param threads Número de hilos trabajadores. Con \c 0 los recursos se preparan al enviarse.
+    explicit ResourceLoader(unsigned threads);
+
+    /// @~english
+    /// @brief Stops the workers and waits for them to finish their current resource.
+    /// @~spanish
+    /// @brief Detiene los trabajadores y espera a que terminen su recurso actual.
+    ~ResourceLoader();
+
+    /// @~english
+    /// @brief Queues a resource to be prepared by a worker.
+    /// @param resource Resource to prepare. It must not be queued already.
+    /// @~spanish
+    /// @brief Encola un recurso para que lo prepare un trabajador.
+    /// @param resource Recurso a preparar. No puede estar ya encolado.
+    void submit(Resource* resource);
+
+    /// @~english
+    /// @brief Pops a resource whose preparation has finished.
+    /// @param resource Out parameter to store the prepared resource.
+    /// @return \c false if there wasn't any prepared resource. \c true otherwise.
+    /// @~spanish
+    /// @brief Extrae un recurso cuya preparación ha terminado.
+    /// @param resource Parámetro de salida para almacenar el recurso preparado.
+    /// @return \c false si no había ningún recurso preparado. \c true en caso contrario.
+    bool poll(Resource*& resource);
+
+    /// @~english
+    /// @brief Blocks until a submitted resource is prepared and takes it out of the loader.
+    /// @param resource Resource previously submitted.
+    /// @~spanish
+    /// @brief Bloquea hasta que un recurso enviado esté preparado y lo saca del cargador.
+    /// @param resource Recurso enviado previamente.
+    void wait(Resource* resource);
+
+    /// @~english
+    /// @brief Takes a submitted resource out of the loader without preparing it if no worker had started.
+    /// @param resource Resource previously submitted.
+    /// @return \c true if the resource had been prepared and must be unloaded. \c false otherwise.
+    /// @~spanish
+    /// @brief Saca un recurso enviado del cargador sin prepararlo si ningún trabajador había empezado.
+    /// @param resource Recurso enviado previamente.
+    /// @return \c true si el recurso se había preparado y debe descargarse. \c false en caso contrario.
+    bool cancel(Resource* resource);
+};
+
+
+#endif //RESOURCELOADER_H
@@ -1,10 +1,14 @@
 #include "ResourceManager.h"
 
+#include <algorithm>
 #include <cassert>
+#include <thread>
 #include <Utils/Error.h>
 
 #include "ResourceMemoryManager.h"
 #include "BaseResourceHandler.h"
+#include "FileSystem.h"
+#include "Resource.h"
 #include "LuaReader.h"
 
 ResourceMemoryManager* ResourceManager::_memoryManager = nullptr;
@@ -17,7 +21,18 @@ bool ResourceManager::initMemoryManager(sol::table const& config) {
     uint64_t maxSize = memory.get_or<uint64_t>("maxSize", 0);
     if (maxSize == 0)
         return false;
-    _memoryManager = new ResourceMemoryManager(maxSize);
+    unsigned defaultThreads = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+    unsigned loadThreads = memory.get_or<unsigned>("loadThreads", defaultThreads);
+    double uploadBudget = memory.get_or<double>("uploadBudget", 2.0);
+    _memoryManager = new ResourceMemoryManager(maxSize, loadThreads,
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::duration<double, std::milli>(uploadBudget)));
+    sol::table budgets = LuaReader::GetTable(memory, "budgets");
+    if (budgets.valid()) {
+        for (auto&& [name, size] : budgets) {
+            if (name.is<std::string>() && size.is<uint64_t>())
+                _memoryManager->setBudget(name.as<std::string>(), size.as<uint64_t>());
+        }
+    }
     return true;
 }
 
@@ -28,6 +43,7 @@ bool ResourceManager::initScenes(sol::table const& config, std::string& scene) {
 
 bool ResourceManager::Init(std::string const& configFile, std::string& scene, std::string& gameName, std::string& gameIcon) {
     assert(_memoryManager == nullptr);
+    FileSystem::Mount("data/game.pak");
     LuaReader::Init();
     sol::table config = LuaReader::GetTable(configFile);
     if (!config.valid()) {
@@ -44,11 +60,37 @@ bool ResourceManager::Init(std::string const& configFile, std::string& scene, st
 }
 
 void ResourceManager::Shutdown() {
+    Resource::_referencesReleased = true;
     for (auto const& handler : _handlers) {
         handler->shutdown();
     }
     _handlers.clear();
     delete _memoryManager;
+    _memoryManager = nullptr;
+    FileSystem::Unmount();
+}
+
+void ResourceManager::Update() {
+    _memoryManager->applyResizes();
+    _memoryManager->finishRequests();
+    _memoryManager->endFrame();
+}
+
+void ResourceManager::ResizeResource(Resource const* resource, uint64_t size) {
+    if (_memoryManager)
+        _memoryManager->resizeResource(const_cast<Resource*>(resource), size);
+}
+
+bool ResourceManager::ReserveMemory(uint64_t size) {
+    if (!_memoryManager)
+        return false;
+    _memoryManager->reserveMemory(size);
+    return true;
+}
+
+void ResourceManager::ReleaseMemory(uint64_t size) {
+    if (_memoryManager)
+        _memoryManager->releaseMemory(size);
 }
 
 void ResourceManager::RegisterResourceHandler(BaseResourceHandler* handler) {
@@ -1,12 +1,14 @@
 #ifndef RESOURCEMANAGER_H
 #define RESOURCEMANAGER_H
 
+#include <cstdint>
 #include <vector>
 #include <string>
 #include <sol/sol.hpp>
 
 class ResourceMemoryManager;
 class BaseResourceHandler;
+class Resource;
 
 class ResourceManager {
 private:
@@ -61,6 +63,42 @@ public:
     /// @brief Registra un \c BaseResourceHandler a inicializar y almacenar.
     /// @param handler Puntero a una instancia de \c BaseResourceHandler .
     static void RegisterResourceHandler(BaseResourceHandler* handler);
+
+    /// @~english
+    /// @brief Counts the resources resized during the frame, finishes the requested resources that are ready and updates the usage order of the resources used during the frame.
+    /// @~spanish
+    /// @brief Cuenta los recursos redimensionados durante el frame, termina los recursos solicitados que estén listos y actualiza el orden de uso de los recursos usados durante el frame.
+    static void Update();
+
+    /// @~english
+    /// @brief Changes the size of a loaded resource whose memory grows or shrinks after its load.
+    /// @remarks It never evicts resources right away. The new size is counted in the next \c Update , after the frame is presented.
+    /// @param resource Resource to resize.
+    /// @param size New size in bytes of the resource.
+    /// @~spanish
+    /// @brief Cambia el tamaño de un recurso cargado cuya memoria crece o decrece tras su carga.
+    /// @remarks Nunca desaloja recursos en el momento. El nuevo tamaño se cuenta en el siguiente \c Update , tras presentar el frame.
+    /// @param resource Recurso a redimensionar.
+    /// @param size Nuevo tamaño en bytes del recurso.
+    static void ResizeResource(Resource const* resource, uint64_t size);
+
+    /// @~english
+    /// @brief Counts memory that isn't a resource, like render targets, against the maximum memory size.
+    /// @param size Size in bytes to reserve.
+    /// @return \c true if the memory was counted, \c false if the \c ResourceManager isn't initialized yet.
+    /// @~spanish
+    /// @brief Cuenta memoria que no es un recurso, como los objetivos de renderizado, contra el tamaño máximo de memoria.
+    /// @param size Tamaño en bytes a reservar.
+    /// @return \c true si se contó la memoria, \c false si el \c ResourceManager aún no está inicializado.
+    static bool ReserveMemory(uint64_t size);
+
+    /// @~english
+    /// @brief Releases memory counted with \c ReserveMemory . It does nothing once the \c ResourceManager is shut down.
+    /// @param size Size in bytes to release.
+    /// @~spanish
+    /// @brief Libera memoria contada con \c ReserveMemory . No hace nada una vez apagado el \c ResourceManager .
+    /// @param size Tamaño en bytes a liberar.
+    static void ReleaseMemory(uint64_t size);
 };
 
 
@@ -1,68 +1,242 @@
 #include "ResourceMemoryManager.h"
 
+#include <algorithm>
 #include <Utils/Error.h>
 
-#include "Resource.h"
 
+ResourceMemoryManager::Budget* ResourceMemoryManager::findBudget(Resource const* resource) {
+    std::string_view name = resource->getBudget();
+    if (name.empty())
+        return nullptr;
+    auto it = _budgets.find(name);
+    return it != _budgets.end() ? &it->second : nullptr;
+}
+
+bool ResourceMemoryManager::evictOne(Budget const* budget) {
+    bool recentFirst = _recentSize > _maxSize / 4;
+    if (recentFirst && evictFrom(_recentResources, true, budget))
+        return true;
+    return evictFrom(_frequentResources, false, budget) || evictFrom(_recentResources, true, budget);
+}
+
+bool ResourceMemoryManager::makeRoomForSize(uint64_t size, Budget* budget) {
+    if (size > _maxSize || (budget && size > budget->maxSize))
+        return false;
+    commitTouched();
+    while (budget && budget->currentSize + size > budget->maxSize) {
+        if (!evictOne(budget))
+            return false;
+    }
+    while (_currentSize + size > _maxSize) {
+        if (!evictOne(nullptr))
+            return false;
+    }
+    return true;
+}
+
+bool ResourceMemoryManager::insertResource(Resource* resource, Budget* budget) {
+    if (_resourceEntries.contains(resource))
+        return false;
+    bool frequent = forgetGhost(resource);
+    std::list<Resource*>& queue = frequent ? _frequentResources : _recentResources;
+    uint64_t size = resource->getSize();
+    _resourceEntries.insert({resource, {queue.insert(queue.end(), resource), budget, size, frequent}});
+    _currentSize += size;
+    if (!frequent)
+        _recentSize += size;
+    if (budget)
+        budget->currentSize += size;
+    resource->_loadFrame = _frame;
+    return true;
+}
 
-bool ResourceMemoryManager::makeRoomForSize(int size) {
-    if (size > _maxSize)
+bool ResourceMemoryManager::evictFrom(std::list<Resource*>& queue, bool remember, Budget const* budget) {
+    auto it = std::ranges::find_if(queue, [this, budget](Resource* resource) {
+        return resource->_references == 0 && resource->_pins == 0 &&
+            (budget == nullptr || _resourceEntries.at(resource).budget == budget);
+    });
+    if (it == queue.end())
         return false;
-    for (auto it = _resources.begin();
-        it != _resources.end() && _currentSize + size > _maxSize;
-        it = _resources.erase(it)) {
+    Resource* resource = *it;
+    removeResource(resource);
+    if (remember) {
+        _ghostIterators.insert({resource, _ghostResources.insert(_ghostResources.end(), resource)});
+        while (_ghostResources.size() > std::max<size_t>(_resourceEntries.size(), 32)) {
+            _ghostIterators.erase(_ghostResources.front());
+            _ghostResources.pop_front();
+        }
+    }
+    unloadResource(resource);
+    return true;
+}
 
-        (*it)->unload();
-        _resourcesIterators.erase(*it);
-        _currentSize -= (*it)->getSize();
+bool ResourceMemoryManager::removeResource(Resource* resource) {
+    auto it = _resourceEntries.find(resource);
+    if (it == _resourceEntries.end())
+        return false;
+    ResourceEntry const& entry = it->second;
+    if (entry.frequent) {
+        _frequentResources.erase(entry.iterator);
+    }
+    else {
+        _recentResources.erase(entry.iterator);
+        _recentSize -= entry.size;
     }
+    _currentSize -= entry.size;
+    if (entry.budget)
+        entry.budget->currentSize -= entry.size;
+    _resourceEntries.erase(it);
     return true;
 }
 
-bool ResourceMemoryManager::insertResource(Resource* resource) {
-    if (_resourcesIterators.contains(resource))
+bool ResourceMemoryManager::forgetGhost(Resource* resource) {
+    auto it = _ghostIterators.find(resource);
+    if (it == _ghostIterators.end())
         return false;
-    _resourcesIterators.insert({resource, _resources.insert(_resources.end(), resource)});
-    _currentSize += resource->getSize();
+    _ghostResources.erase(it->second);
+    _ghostIterators.erase(it);
     return true;
 }
 
-ResourceMemoryManager::ResourceMemoryManager(uint64_t maxSize) :
+void ResourceMemoryManager::unloadResource(Resource* resource) {
+    if (resource->_touched) {
+        std::erase(_touchedResources, resource);
+        resource->_touched = false;
+    }
+    resource->unload();
+    resource->_state = Resource::LoadState::UNLOADED;
+    ++resource->_generation;
+}
+
+ResourceMemoryManager::ResourceMemoryManager(uint64_t maxSize, unsigned loadThreads, std::chrono::nanoseconds uploadBudget) :
     _maxSize(maxSize),
-    _currentSize(0) {
+    _currentSize(0),
+    _recentSize(0),
+    _frame(0),
+    _loader(loadThreads),
+    _uploadBudget(uploadBudget) {
+}
+
+void ResourceMemoryManager::setBudget(std::string_view name, uint64_t maxSize) {
+    auto it = _budgets.find(name);
+    if (it == _budgets.end())
+        it = _budgets.emplace(std::string(name), Budget{maxSize, 0}).first;
+    it->second.maxSize = maxSize;
 }
 
 bool ResourceMemoryManager::activateResource(Resource* resource) {
-    if (auto it = _resourcesIterators.find(resource); it != _resourcesIterators.end()) {
-        _resources.splice(_resources.end(), _resources, it->second);
+    if (resource->_state == Resource::LoadState::LOADED) {
+        touchResource(resource);
         return true;
     }
+    if (resource->_state == Resource::LoadState::REQUESTED)
+        _loader.wait(resource);
+    else if (resource->_state == Resource::LoadState::UNLOADED)
+        resource->prepare();
+    resource->_state = Resource::LoadState::UNLOADED;
     if (!resource->load())
         return false;
-    if (resource->getSize() < 0) {
-        resource->unload();
-        Error::ShowError("Invalid resource size.", "Tried to insert a resource with size " + std::to_string(resource->getSize()) + ".");
-        return false;
-    }
+    ++resource->_generation;
 
-    if (_currentSize + resource->getSize() >= _maxSize &&
-        !makeRoomForSize(resource->getSize())) {
-        resource->unload();
-        return false;
-    }
-    if (!insertResource(resource)) {
-        resource->unload();
+    Budget* budget = findBudget(resource);
+    uint64_t size = resource->getSize();
+    bool overBudget = budget && budget->currentSize + size > budget->maxSize;
+    if ((_currentSize + size > _maxSize || overBudget) && !makeRoomForSize(size, budget))
+        Error::LogWarning("Memoria excedida", "Se carga " + resource->_path + " por encima del límite de memoria porque no hay recursos que liberar");
+    if (!insertResource(resource, budget)) {
+        unloadResource(resource);
         return false;
     }
+    resource->_state = Resource::LoadState::LOADED;
     return true;
 }
 
+void ResourceMemoryManager::requestResource(Resource* resource) {
+    if (resource->_state != Resource::LoadState::UNLOADED)
+        return;
+    resource->_state = Resource::LoadState::REQUESTED;
+    _loader.submit(resource);
+}
+
+void ResourceMemoryManager::finishRequests() {
+    auto start = std::chrono::steady_clock::now();
+    Resource* resource;
+    while (std::chrono::steady_clock::now() - start < _uploadBudget && _loader.poll(resource)) {
+        resource->_state = Resource::LoadState::PREPARED;
+        activateResource(resource);
+    }
+}
+
 void ResourceMemoryManager::deactivateResource(Resource* resource) {
-    auto it = _resourcesIterators.find(resource);
-    if (it == _resourcesIterators.end())
+    if (resource->_state == Resource::LoadState::REQUESTED) {
+        if (_loader.cancel(resource))
+            resource->unload();
+        resource->_state = Resource::LoadState::UNLOADED;
         return;
-    _resources.erase(it->second);
-    _resourcesIterators.erase(it);
-    _currentSize -= resource->getSize();
-    resource->unload();
+    }
+    forgetGhost(resource);
+    if (!removeResource(resource))
+        return;
+    unloadResource(resource);
+}
+
+void ResourceMemoryManager::commitTouched() {
+    for (Resource* resource : _touchedResources) {
+        resource->_touched = false;
+        auto it = _resourceEntries.find(resource);
+        if (it == _resourceEntries.end())
+            continue;
+        ResourceEntry& entry = it->second;
+        if (entry.frequent) {
+            _frequentResources.splice(_frequentResources.end(), _frequentResources, entry.iterator);
+        }
+        else if (resource->_loadFrame != _frame) {
+            _frequentResources.splice(_frequentResources.end(), _recentResources, entry.iterator);
+            _recentSize -= entry.size;
+            entry.frequent = true;
+        }
+    }
+    _touchedResources.clear();
+}
+
+void ResourceMemoryManager::endFrame() {
+    commitTouched();
+    ++_frame;
+}
+
+void ResourceMemoryManager::resizeResource(Resource* resource, uint64_t size) {
+    resource->_size = size;
+    if (_resourceEntries.contains(resource))
+        _resizedResources.push_back(resource);
+}
+
+void ResourceMemoryManager::applyResizes() {
+    for (Resource* resource : _resizedResources) {
+        auto it = _resourceEntries.find(resource);
+        uint64_t size = resource->_size;
+        if (it == _resourceEntries.end() || it->second.size == size)
+            continue;
+        if (size > it->second.size) {
+            pinResource(resource);
+            makeRoomForSize(size - it->second.size, it->second.budget);
+            unpinResource(resource);
+        }
+        ResourceEntry& entry = it->second;
+        _currentSize = _currentSize - entry.size + size;
+        if (!entry.frequent)
+            _recentSize = _recentSize - entry.size + size;
+        if (entry.budget)
+            entry.budget->currentSize = entry.budget->currentSize - entry.size + size;
+        entry.size = size;
+    }
+    _resizedResources.clear();
+}
+
+void ResourceMemoryManager::reserveMemory(uint64_t size) {
+    makeRoomForSize(size, nullptr);
+    _currentSize += size;
+}
+
+void ResourceMemoryManager::releaseMemory(uint64_t size) {
+    _currentSize -= std::min(size, _currentSize);
 }
@@ -1,65 +1,197 @@
 #ifndef RESOURCEMEMORYMANAGER_H
 #define RESOURCEMEMORYMANAGER_H
 
+#include <chrono>
 #include <cstdint>
 #include <list>
+#include <map>
+#include <string>
+#include <string_view>
 #include <unordered_map>
+#include <vector>
 
-class Resource;
+#include "Resource.h"
+#include "ResourceLoader.h"
 
 /// @~english
 /// @brief Data structure responsible for managing the memory occupied by resources. It ensures that there won't ever be more simultaneous memory used in resources than the assigned maximum size.
+/// @details Resources are evicted with a 2Q policy: newly loaded resources wait in a FIFO queue and only move to an LRU queue when they're used again in a later frame, so one-off loads can't push out the resources used every frame.
+/// Referenced or pinned resources are never evicted. Each type of resource can also have its own budget, so a single type can't take all the memory.
 /// @~spanish
 /// @brief Estructura de datos que se encarga de gestionar la memoria ocupada por recursos. Asegura que nunca se estará usando más memoria en recursos simultáneamente como el tamaño máximo asignado.
+/// @details Los recursos se desalojan con una política 2Q: los recursos recién cargados esperan en una cola FIFO y solo pasan a una cola LRU cuando se vuelven a usar en un frame posterior, por lo que las cargas puntuales no pueden expulsar a los recursos usados en cada frame.
+/// Los recursos referenciados o fijados nunca se desalojan. Cada tipo de recurso puede tener además su propio presupuesto, para que un solo tipo no pueda ocupar toda la memoria.
 class ResourceMemoryManager {
 private:
+    struct Budget {
+        uint64_t maxSize;
+        uint64_t currentSize;
+    };
+
+    struct ResourceEntry {
+        std::list<Resource*>::iterator iterator;
+        Budget* budget;
+        uint64_t size;
+        bool frequent;
+    };
+
     uint64_t _maxSize;
     uint64_t _currentSize;
+    uint64_t _recentSize;
+    uint64_t _frame;
 
-    std::list<Resource*> _resources;
-    std::unordered_map<Resource*, std::list<Resource*>::iterator> _resourcesIterators;
+    std::list<Resource*> _recentResources;
+    std::list<Resource*> _frequentResources;
+    std::unordered_map<Resource*, ResourceEntry> _resourceEntries;
+    std::map<std::string, Budget, std::less<>> _budgets;
+    std::list<Resource*> _ghostResources;
+    std::unordered_map<Resource*, std::list<Resource*>::iterator> _ghostIterators;
+    std::vector<Resource*> _touchedResources;
+    std::vector<Resource*> _resizedResources;
+    ResourceLoader _loader;
+    std::chrono::nanoseconds _uploadBudget;
+
+    /// @~english
+    /// @brief Finds the budget of a resource.
+    /// @param resource Resource whose budget is wanted.
+    /// @return Budget the resource counts against. \c nullptr if its type has no budget.
+    /// @~spanish
+    /// @brief Busca el presupuesto de un recurso.
+    /// @param resource Recurso cuyo presupuesto se quiere.
+    /// @return Presupuesto al que cuenta el recurso. \c nullptr si su tipo no tiene presupuesto.
+    Budget* findBudget(Resource const* resource);
+
+    /// @~english
+    /// @brief Evicts one resource, following the 2Q order.
+    /// @remarks The oldest new resources are evicted first while they take more than a quarter of the maximum size, then the least recently used ones.
+    /// @param budget Budget the evicted resource must count against. \c nullptr to evict from any budget.
+    /// @return \c true if a resource was evicted. \c false if none could be.
+    /// @~spanish
+    /// @brief Desaloja un recurso, siguiendo el orden 2Q.
+    /// @remarks Primero se desalojan los recursos nuevos más antiguos mientras ocupen más de un cuarto del tamaño máximo, después los menos usados recientemente.
+    /// @param budget Presupuesto al que debe contar el recurso desalojado. \c nullptr para desalojar de cualquier presupuesto.
+    /// @return \c true si se desalojó un recurso. \c false si no se pudo desalojar ninguno.
+    bool evictOne(Budget const* budget);
 
     /// @~english
-    /// @brief Removes stored resources from the manager until there's as much empty space as asked.
-    /// @remarks The resources are removed using a Least Recently Used politic.
+    /// @brief Removes stored resources from the manager until there's as much empty space as asked, both in total and in the given budget.
     /// @param size Size in bytes wanted available.
-    /// @return \c false if there's not enough size in the manager to fit the amount asked. \c true otherwise.
+    /// @param budget Budget the space is wanted in. \c nullptr if it's only wanted in total.
+    /// @return \c false if there's not enough size in the manager to fit the amount asked, counting only the resources that can be evicted. \c true otherwise.
     /// @~spanish
-    /// @brief Elimina los recursos almacenados en el gestor hasta que haya tanto espacio como el pedido.
-    /// @remarks Los recursos se eliminan usando una política <i>Least Recently Used</i> (Menos recientemente usado).
+    /// @brief Elimina los recursos almacenados en el gestor hasta que haya tanto espacio como el pedido, tanto en total como en el presupuesto dado.
     /// @param size Tamaño en bytes que se quiere disponible.
-    /// @return \c false si no hay espacio suficiente en el gestor para encajar el monto solicitado. \c true en caso contrario.
-    bool makeRoomForSize(int size);
+    /// @param budget Presupuesto en el que se quiere el espacio. \c nullptr si solo se quiere en total.
+    /// @return \c false si no hay espacio suficiente en el gestor para encajar el monto solicitado, contando solo los recursos que pueden desalojarse. \c true en caso contrario.
+    bool makeRoomForSize(uint64_t size, Budget* budget);
 
     /// @~english
     /// @brief Inserts in the manager an already loaded <c>Resource</c>.
     /// @param resource Resource to insert.
+    /// @param budget Budget the resource counts against.
     /// @return \c false if the resource was already inserted. \c true otherwise.
     /// @~spanish
     /// @brief Inserta en el gestor un \c Resource ya cargado.
     /// @param resource Recurso a insertar.
+    /// @param budget Presupuesto al que cuenta el recurso.
     /// @return \c false si el recurso ya estaba insertado. \c true en caso contrario.
-    bool insertResource(Resource* resource);
+    bool insertResource(Resource* resource, Budget* budget);
+
+    /// @~english
+    /// @brief Evicts the first resource of a queue that isn't referenced nor pinned.
+    /// @param queue Queue to evict from.
+    /// @param remember Whether to remember the evicted resource, so it goes to the frequent queue if it's loaded again soon.
+    /// @param budget Budget the evicted resource must count against. \c nullptr to evict from any budget.
+    /// @return \c true if a resource was evicted. \c false if none of the queue could be.
+    /// @~spanish
+    /// @brief Desaloja el primer recurso de una cola que no esté referenciado ni fijado.
+    /// @param queue Cola de la que desalojar.
+    /// @param remember Si se debe recordar el recurso desalojado, para que pase a la cola frecuente si se vuelve a cargar pronto.
+    /// @param budget Presupuesto al que debe contar el recurso desalojado. \c nullptr para desalojar de cualquier presupuesto.
+    /// @return \c true si se desalojó un recurso. \c false si no se pudo desalojar ninguno de la cola.
+    bool evictFrom(std::list<Resource*>& queue, bool remember, Budget const* budget);
+
+    /// @~english
+    /// @brief Removes an inserted resource from its queue without unloading it.
+    /// @param resource Resource to remove.
+    /// @return \c false if the resource wasn't inserted. \c true otherwise.
+    /// @~spanish
+    /// @brief Elimina un recurso insertado de su cola sin descargarlo.
+    /// @param resource Recurso a eliminar.
+    /// @return \c false si el recurso no estaba insertado. \c true en caso contrario.
+    bool removeResource(Resource* resource);
+
+    /// @~english
+    /// @brief Forgets a resource remembered after its eviction.
+    /// @param resource Resource to forget.
+    /// @return \c true if the resource was remembered. \c false otherwise.
+    /// @~spanish
+    /// @brief Olvida un recurso recordado tras su desalojo.
+    /// @param resource Recurso a olvidar.
+    /// @return \c true si el recurso estaba recordado. \c false en caso contrario.
+    bool forgetGhost(Resource* resource);
+
+    /// @~english
+    /// @brief Unloads a resource, changes its generation and forgets it was touched.
+    /// @param resource Resource to unload.
+    /// @~spanish
+    /// @brief Descarga un recurso, cambia su generación y olvida que fue usado.
+    /// @param resource Recurso a descargar.
+    void unloadResource(Resource* resource);
     
 public:
     /// @~english
     /// @brief Creates a new <c>ResourceMemoryManager</c>.
     /// @param maxSize Maximum size in bytes to be simultaneously used by resources.
+    /// @param loadThreads Number of worker threads used to prepare requested resources.
+    /// @param uploadBudget Maximum time per frame spent finishing requested resources on the main thread.
     /// @~spanish
     /// @brief Crea un nuevo <c>ResourceMemoryManager</c>.
     /// @param maxSize Tamaño máximo en bytes a usar simultáneamente por recursos.
-    explicit ResourceMemoryManager(uint64_t maxSize);
+    /// @param loadThreads Número de hilos trabajadores usados para preparar los recursos solicitados.
+    /// @param uploadBudget Tiempo máximo por frame dedicado a terminar en el hilo principal los recursos solicitados.
+    ResourceMemoryManager(uint64_t maxSize, unsigned loadThreads, std::chrono::nanoseconds uploadBudget);
+
+    /// @~english
+    /// @brief Limits the memory used by the resources of a type. Resources already loaded aren't evicted until another one of the type is loaded.
+    /// @param name Name of the budget, as returned by \c Resource::getBudget .
+    /// @param maxSize Maximum size in bytes to be simultaneously used by the resources of the budget.
+    /// @~spanish
+    /// @brief Limita la memoria usada por los recursos de un tipo. Los recursos ya cargados no se desalojan hasta que se cargue otro del tipo.
+    /// @param name Nombre del presupuesto, tal y como lo devuelve \c Resource::getBudget .
+    /// @param maxSize Tamaño máximo en bytes a usar simultáneamente por los recursos del presupuesto.
+    void setBudget(std::string_view name, uint64_t maxSize);
 
     /// @~english
     /// @brief Makes sure a resource is loaded. If it was already loaded it will do nothing.
     /// @param resource Resource to activate.
-    /// @return \c true on successful activation. \c false if the load failed or the resource can't fit within the maximum size.
+    /// @remarks If the resource was requested, it waits for its preparation to end.
+    /// If nothing can be evicted to fit it within the maximum size or its budget, it is kept over the limit and a warning is logged.
+    /// @return \c true on successful activation. \c false if the load failed.
     /// @~spanish
     /// @brief Se asegura de que un recurso está cargado. Si ya estaba cargado no hará nada.
     /// @param resource Recurso a activar.
-    /// @return \c true si se activa exitosamente. \c false si la carga falló o el recurso no entra dentro del tamaño máximo.
+    /// @remarks Si el recurso estaba solicitado, espera a que termine su preparación.
+    /// Si no se puede liberar nada para que entre dentro del tamaño máximo o de su presupuesto, se mantiene por encima del límite y se registra un aviso.
+    /// @return \c true si se activa exitosamente. \c false si la carga falló.
     bool activateResource(Resource* resource);
 
+    /// @~english
+    /// @brief Starts preparing a resource in the background. It will be activated by \c finishRequests or by the first \c activateResource .
+    /// @remarks This function won't do anything if the resource was already activated or requested.
+    /// @param resource Resource to request.
+    /// @~spanish
+    /// @brief Empieza a preparar un recurso en segundo plano. Lo activará \c finishRequests o el primer \c activateResource .
+    /// @remarks Esta función no hará nada si el recurso ya estaba activado o solicitado.
+    /// @param resource Recurso a solicitar.
+    void requestResource(Resource* resource);
+
+    /// @~english
+    /// @brief Activates the requested resources whose preparation has finished, until the upload budget of the frame runs out.
+    /// @~spanish
+    /// @brief Activa los recursos solicitados cuya preparación ha terminado, hasta que se agote el presupuesto de subida del frame.
+    void finishRequests();
+
     /// @~english
     /// @brief Deactivates a previously activated resource. It becomes unloaded and gets removed from the manager.
     /// @remarks This function won't do anything if the resource wasn't activated before.
@@ -69,6 +201,90 @@ public:
     /// @remarks Esta función no hará nada si el recurso no se había activado antes.
     /// @param resource Recurso a desactivar.
     void deactivateResource(Resource* resource);
+
+    /// @~english
+    /// @brief Marks an activated resource as recently used without reordering the manager.
+    /// @remarks The order is updated in the next call to \c commitTouched.
+    /// @param resource Resource to mark.
+    /// @~spanish
+    /// @brief Marca un recurso activado como usado recientemente sin reordenar el gestor.
+    /// @remarks El orden se actualiza en la siguiente llamada a \c commitTouched.
+    /// @param resource Recurso a marcar.
+    inline void touchResource(Resource* resource) {
+        if (resource->_touched)
+            return;
+        resource->_touched = true;
+        _touchedResources.push_back(resource);
+    }
+
+    /// @~english
+    /// @brief Moves every resource marked with \c touchResource to the most recently used position.
+    /// @remarks New resources used in a frame after the one they were loaded in are promoted to the frequent queue.
+    /// @~spanish
+    /// @brief Mueve todos los recursos marcados con \c touchResource a la posición de usado más recientemente.
+    /// @remarks Los recursos nuevos usados en un frame posterior al de su carga se promocionan a la cola frecuente.
+    void commitTouched();
+
+    /// @~english
+    /// @brief Commits the resources used during the frame and starts a new one.
+    /// @~spanish
+    /// @brief Confirma los recursos usados durante el frame y empieza uno nuevo.
+    void endFrame();
+
+    /// @~english
+    /// @brief Changes the size of an activated resource whose memory grows or shrinks after its load.
+    /// @remarks The new size is counted by \c applyResizes , so resizing never evicts resources in the middle of a frame.
+    /// @param resource Resource to resize.
+    /// @param size New size in bytes of the resource.
+    /// @~spanish
+    /// @brief Cambia el tamaño de un recurso activado cuya memoria crece o decrece tras su carga.
+    /// @remarks El nuevo tamaño lo cuenta \c applyResizes , así que redimensionar nunca desaloja recursos en mitad de un frame.
+    /// @param resource Recurso a redimensionar.
+    /// @param size Nuevo tamaño en bytes del recurso.
+    void resizeResource(Resource* resource, uint64_t size);
+
+    /// @~english
+    /// @brief Counts the sizes changed with \c resizeResource , evicting other resources if they don't fit anymore.
+    /// @~spanish
+    /// @brief Cuenta los tamaños cambiados con \c resizeResource , desalojando otros recursos si ya no caben.
+    void applyResizes();
+
+    /// @~english
+    /// @brief Counts memory that isn't a resource, like render targets, against the maximum size, evicting resources to make room for it.
+    /// @param size Size in bytes to reserve.
+    /// @~spanish
+    /// @brief Cuenta memoria que no es un recurso, como los objetivos de renderizado, contra el tamaño máximo, desalojando recursos para hacerle sitio.
+    /// @param size Tamaño en bytes a reservar.
+    void reserveMemory(uint64_t size);
+
+    /// @~english
+    /// @brief Undoes a previous \c reserveMemory .
+    /// @param size Size in bytes to release.
+    /// @~spanish
+    /// @brief Deshace un \c reserveMemory previo.
+    /// @param size Tamaño en bytes a liberar.
+    void releaseMemory(uint64_t size);
+
+    /// @~english
+    /// @brief Pins a resource so it's never evicted until it's unpinned as many times.
+    /// @param resource Resource to pin.
+    /// @~spanish
+    /// @brief Fija un recurso para que nunca se desaloje hasta que se desfije las mismas veces.
+    /// @param resource Recurso a fijar.
+    inline void pinResource(Resource* resource) {
+        ++resource->_pins;
+    }
+
+    /// @~english
+    /// @brief Undoes a previous \c pinResource .
+    /// @param resource Resource to unpin.
+    /// @~spanish
+    /// @brief Deshace un \c pinResource previo.
+    /// @param resource Recurso a desfijar.
+    inline void unpinResource(Resource* resource) {
+        if (resource->_pins > 0)
+            --resource->_pins;
+    }
 };
 
 
@@ -61,7 +61,12 @@ int Main::Loop() {
         _render->getWindowSize(&w, &h);
         _time->update();
         _input->update(w,h);
-        _collisions->fixedUpdate();
+        _collisions->clearCollisionEvents();
+        while (_time->fixedStep()) {
+            _collisions->fixedUpdate();
+            if (!_scenes->fixedUpdate())
+                return 1;
+        }
         if (!_scenes->update())
             return 1;
         _render->clear();
@@ -69,6 +74,7 @@ int Main::Loop() {
             return 1;
         _render->present();
         _scenes->refresh();
+        ResourceManager::Update();
     }
     Shutdown();
     return 0;
@@ -1,6 +1,7 @@
 #include "Animation.h"
 
 #include <Load/LuaReader.h>
+#include <Utils/MemorySize.h>
 #include <Utils/Error.h>
 
 Animation::Animation(std::string const &path) :
@@ -28,7 +29,7 @@ bool Animation::load() {
     frameTime = table.get_or("frameTime", 0.5f);
     loop = table.get_or("loop", false);
     numFrames = static_cast<int>(frames.size());
-    _size = 0;
+    _size = sizeof(Animation) + MemorySize::Of(frames);
     return true;
 }
 
@@ -37,4 +38,9 @@ void Animation::unload() {
     numFrames = 0;
     loop = false;
     frameTime = 0.0f;
+    _size = 0;
+}
+
+std::string_view Animation::getBudget() const {
+    return "animations";
 }
@@ -2,15 +2,17 @@
 #define ANIMATION_H
 #include <vector>
 #include <Load/Resource.h>
+#include <Utils/Symbol.h>
 
 class Animation : public Resource {
 public:
-  std::vector<std::string> frames;
+  std::vector<Symbol> frames;
   float frameTime;
   bool loop;
   int numFrames;
   explicit Animation(std::string const &path);
   bool load() override;
   void unload() override;
+  std::string_view getBudget() const override;
 };
 #endif //ANIMATION_H
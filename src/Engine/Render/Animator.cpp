@@ -9,21 +9,22 @@ Animator::Animator(ComponentData const*data) : ComponentTemplate(data) {
 }
 
 bool Animator::init() {
-  _animation = _data->getData<std::string>("animation", "");
-  _defaultSprite = _data->getData<std::string>("sprite", "");
+  const Data& data = _data->get<Data>();
+  _animation.reset(data.animation);
+  _defaultSprite = data.sprite;
   if (!_defaultSprite.empty()) {
     if (!setSprite(_defaultSprite)) {
       return false;
     }
   }
   if (!_animation.empty()) {
-    const Animation* anim = ResourceHandler<Animation>::Instance()->get(_animation);
+    const Animation* anim = _animation.get();
     if (!anim)
       return false;
     if (!setSprite(anim->frames[_currentFrame]))
       return false;
   }
-  _playing = _data->getData<bool>("playing", false);
+  _playing = data.playing;
 
   return RenderComponent::init();
 }
@@ -38,7 +39,7 @@ bool Animator::update() {
       return true;
     }
     _frameTimer += Time::deltaTime;
-    const Animation* anim = ResourceHandler<Animation>::Instance()->get(_animation);
+    const Animation* anim = _animation.get();
     if(!anim) return false;
     while (_frameTimer >= anim->frameTime) {
         _frameTimer -= anim->frameTime;
@@ -68,9 +69,9 @@ void Animator::reset() {
   _playing = true;
 }
 
-void Animator::changeAnimation(const std::string& animation) {
-  if (_animation != animation) {
-    _animation = animation;
+void Animator::changeAnimation(const Symbol& animation) {
+  if (_animation.getKey() != animation) {
+    _animation.reset(animation);
     reset();
   }
 }
@@ -86,8 +87,16 @@ bool Animator::animationEnded() const {
 void Animator::RegisterToLua(sol::state& lua) {
     sol::usertype<Animator> type = lua.new_usertype<Animator>("Animator");
     type["reset"] = &Animator::reset;
-    type["changeAnimation"] = &Animator::changeAnimation;
+    type["changeAnimation"] = sol::overload(&Animator::changeAnimation, [](Animator& animator, const std::string& animation) {
+        animator.changeAnimation(animation);
+    });
     type["setPlaying"] = &Animator::setPlaying;
     type["animationEnded"] = &Animator::animationEnded;
     type["get"] = Animator::get;
 }
+
+void Animator::DeclareSchema(ComponentSchemaTemplate<Data>& schema) {
+    SpriteRenderer::DeclareSchema(schema);
+    schema.field("animation", &Data::animation, "")
+        .field("playing", &Data::playing, false);
+}
@@ -4,19 +4,26 @@
 
 #include <sol/forward.hpp>
 
+class Animation;
+
 class ComponentDerived(Animator, SpriteRenderer) {
-    std::string _animation {};
-    std::string _defaultSprite {};
+    ResourceHandle<Animation> _animation {};
+    Symbol _defaultSprite {};
     float _frameTimer {};
     int _currentFrame {};
     bool _animationEnded {};
     bool _playing {};
 public:
+    struct Data : SpriteRenderer::Data {
+        Symbol animation;
+        bool playing;
+    };
     Animator(ComponentData const* data);
+    static void DeclareSchema(ComponentSchemaTemplate<Data>& schema);
     bool init() override;
     bool update() override;
     void reset();
-    void changeAnimation(const std::string& animation);
+    void changeAnimation(const Symbol& animation);
     void setPlaying(bool playing);
     bool animationEnded() const;
 
@@ -7,7 +7,10 @@ Camera::Camera(ComponentData const*data) : ComponentTemplate(data) {
 }
 
 bool Camera::init() {
-    _size = _data->getVector("size",{1280 ,720});
+    const Data& data = _data->get<Data>();
+    _size = data.size;
+    _virtualResolution = data.virtualResolution;
+    _integerScale = data.integerScale;
     if (!RenderComponent::init()) return false;
     _layer = -1;
     return true;
@@ -15,7 +18,9 @@ bool Camera::init() {
 
 bool Camera::render(RenderManager *manager) {
     Vector2 position = _transform->getGlobalPosition();
-    auto [screenScale, screenOffset] = manager->setViewRect(position - _size/2.f, _size);
+    auto [screenScale, screenOffset] = _virtualResolution
+        ? manager->setVirtualView(position - _size/2.f, _size, _integerScale)
+        : manager->setViewRect(position - _size/2.f, _size);
     _screenScale = screenScale;
     _screenOffset = screenOffset;
     return true;
@@ -25,3 +30,10 @@ Vector2 Camera::screenToWorld(const Vector2& screenPos) const {
     Vector2 position = _transform->getGlobalPosition();
     return (screenPos - _screenOffset) / _screenScale + (position - _size / 2.0f);
 }
+
+void Camera::DeclareSchema(ComponentSchemaTemplate<Data>& schema) {
+    RenderComponent::DeclareSchema(schema);
+    schema.field("size", &Data::size, Vector2(1280, 720))
+        .field("virtualResolution", &Data::virtualResolution, false)
+        .field("integerScale", &Data::integerScale, false);
+}
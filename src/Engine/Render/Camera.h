@@ -8,8 +8,16 @@ private:
     Vector2 _size = {1,1};
     Vector2 _screenOffset = {0,0};
     float _screenScale = 1;
+    bool _virtualResolution = false;
+    bool _integerScale = false;
 public:
+    struct Data : RenderComponent::Data {
+        Vector2 size;
+        bool virtualResolution;
+        bool integerScale;
+    };
     Camera(ComponentData const* data);
+    static void DeclareSchema(ComponentSchemaTemplate<Data>& schema);
     bool init() override;
     bool render(RenderManager* manager) override;
     Vector2 screenToWorld(const Vector2& screenPos) const;
@@ -1,16 +1,11 @@
 #include "Font.h"
 #include <SDL3_ttf/SDL_ttf.h>
+#include <algorithm>
+#include <Load/FileSystem.h>
+#include <Load/ResourceManager.h>
 #include <Utils/Error.h>
 
-
-#include <SDL3/SDL.h>
-#ifdef __APPLE__
-#define GetCurrentDir strdup(SDL_GetBasePath())
-#else
-#define GetCurrentDir SDL_GetCurrentDirectory()
-#endif
-
-Font::Font(std::string const &path) : Resource(path), _font(nullptr) {
+Font::Font(std::string const &path) : Resource(path), _font(nullptr), _pageCount(0), _fileSize(0) {
 }
 
 bool Font::load() {
@@ -19,25 +14,50 @@ bool Font::load() {
         index++;
     }
     int fontSize = std::stoi(_path.substr(0, index));
-#ifdef __APPLE__
-    auto currDir = GetCurrentDir;
-    std::string fontPath = currDir + _path.substr(index);
-    SDL_free(currDir);
-#else
     std::string fontPath = _path.substr(index);
-#endif
-    _font = TTF_OpenFont(fontPath.c_str(), fontSize);
+    SDL_IOStream* file = FileSystem::Open(fontPath);
+    _fileSize = file ? std::max<Sint64>(SDL_GetIOSize(file), 0) : 0;
+    _font = file ? TTF_OpenFontIO(file, true, fontSize) : nullptr;
     if (_font == nullptr) {
         Error::ShowError("Fallo al cargar la fuente " + fontPath, "Fallo al cargar la fuente " + fontPath + "\n" + SDL_GetError());
         return false;
     }
-    int width, height;
-    int glyphs = 95;
-    TTF_GetGlyphMetrics(_font,'M',nullptr,&width, nullptr,&height,nullptr);
-    _size = glyphs * width * height;
+    _glyphs.init(_font);
+    _pageCount = 0;
+    _size = _fileSize;
     return true;
 }
 
 void Font::unload() {
+    _glyphs.clear();
     TTF_CloseFont(_font);
+    _font = nullptr;
+    _pageCount = 0;
+    _fileSize = 0;
+    _size = 0;
+}
+
+std::string_view Font::getBudget() const {
+    return "fonts";
+}
+
+const Glyph* Font::getGlyph(uint32_t codepoint) const {
+    const Glyph* glyph = _glyphs.getGlyph(codepoint);
+    if (_glyphs.getPageCount() != _pageCount) {
+        _pageCount = _glyphs.getPageCount();
+        ResourceManager::ResizeResource(this, _fileSize + _pageCount * _glyphs.getPageBytes());
+    }
+    return glyph;
+}
+
+int Font::getAdvance(uint32_t codepoint) const {
+    return _glyphs.getAdvance(codepoint);
+}
+
+int Font::getKerning(uint32_t previous, uint32_t codepoint) const {
+    return _glyphs.getKerning(previous, codepoint);
+}
+
+int Font::getLineSkip() const {
+    return _glyphs.getLineSkip();
 }
@@ -2,18 +2,27 @@
 #define FONT_H
 #include <Load/Resource.h>
 #include <SDL3_ttf/SDL_ttf.h>
+#include "GlyphAtlas.h"
 
 class TTF_Font;
 
 class Font : public Resource {
     private:
         TTF_Font* _font;
+        mutable GlyphAtlas _glyphs;
+        mutable size_t _pageCount;
+        uint64_t _fileSize;
     public:
         explicit Font(std::string const &path);
         bool load() override;
         void unload() override;
+        std::string_view getBudget() const override;
 
         TTF_Font *getFont() const { return _font; }
+        const Glyph* getGlyph(uint32_t codepoint) const;
+        int getAdvance(uint32_t codepoint) const;
+        int getKerning(uint32_t previous, uint32_t codepoint) const;
+        int getLineSkip() const;
 };
 
 #endif //FONT_H
@@ -0,0 +1,102 @@
+#include "GlyphAtlas.h"
+#include "TextureLoader.h"
+#include <SDL3/SDL.h>
+#include <algorithm>
+
+GlyphAtlas::GlyphAtlas(int pageSize) : _font(nullptr), _pageSize(pageSize), _shelfX(0), _shelfY(0), _shelfHeight(0) {
+}
+
+GlyphAtlas::~GlyphAtlas() {
+    clear();
+}
+
+void GlyphAtlas::init(TTF_Font* font) {
+    clear();
+    _font = font;
+}
+
+void GlyphAtlas::clear() {
+    for (SDL_Texture* page : _pages) {
+        SDL_DestroyTexture(page);
+    }
+    _pages.clear();
+    _glyphs.clear();
+    _advances.clear();
+    _kerning.clear();
+    _shelfX = _shelfY = _shelfHeight = 0;
+    _font = nullptr;
+}
+
+bool GlyphAtlas::addPage() {
+    SDL_Texture* page = TextureLoader::GetBlank(_pageSize, _pageSize);
+    if (!page) return false;
+    _pages.push_back(page);
+    _shelfX = _shelfY = _shelfHeight = 0;
+    return true;
+}
+
+const Glyph* GlyphAtlas::getGlyph(uint32_t codepoint) {
+    if (auto it = _glyphs.find(codepoint); it != _glyphs.end()) {
+        return &it->second;
+    }
+    if (!_font) return nullptr;
+
+    Glyph glyph = {nullptr, {0, 0, 0, 0}, 0};
+    if (!TTF_GetGlyphMetrics(_font, codepoint, nullptr, nullptr, nullptr, nullptr, &glyph.advance)) {
+        return nullptr;
+    }
+    SDL_Surface* rendered = TTF_RenderGlyph_Solid(_font, codepoint, {255, 255, 255, 255});
+    SDL_Surface* surface = rendered ? SDL_ConvertSurface(rendered, SDL_PIXELFORMAT_RGBA32) : nullptr;
+    SDL_DestroySurface(rendered);
+    if (surface && surface->w > 0 && surface->h > 0 && surface->w <= _pageSize && surface->h <= _pageSize) {
+        if (_shelfX + surface->w > _pageSize) {
+            _shelfX = 0;
+            _shelfY += _shelfHeight + 1;
+            _shelfHeight = 0;
+        }
+        if ((_pages.empty() || _shelfY + surface->h > _pageSize) && !addPage()) {
+            SDL_DestroySurface(surface);
+            return nullptr;
+        }
+        SDL_Rect rect = {_shelfX, _shelfY, surface->w, surface->h};
+        if (SDL_UpdateTexture(_pages.back(), &rect, surface->pixels, surface->pitch)) {
+            glyph.texture = _pages.back();
+            glyph.source = {static_cast<float>(rect.x), static_cast<float>(rect.y), static_cast<float>(rect.w), static_cast<float>(rect.h)};
+        }
+        _shelfX += surface->w + 1;
+        _shelfHeight = std::max(_shelfHeight, surface->h);
+    }
+    SDL_DestroySurface(surface);
+    return &_glyphs.insert({codepoint, glyph}).first->second;
+}
+
+int GlyphAtlas::getAdvance(uint32_t codepoint) {
+    if (auto it = _glyphs.find(codepoint); it != _glyphs.end()) {
+        return it->second.advance;
+    }
+    auto [it, inserted] = _advances.insert({codepoint, 0});
+    if (inserted && _font) {
+        TTF_GetGlyphMetrics(_font, codepoint, nullptr, nullptr, nullptr, nullptr, &it->second);
+    }
+    return it->second;
+}
+
+int GlyphAtlas::getKerning(uint32_t previous, uint32_t codepoint) {
+    auto [it, inserted] = _kerning.insert({static_cast<uint64_t>(previous) << 32 | codepoint, 0});
+    if (inserted && _font && !TTF_GetGlyphKerning(_font, previous, codepoint, &it->second)) {
+        it->second = 0;
+    }
+    return it->second;
+}
+
+int GlyphAtlas::getLineSkip() const {
+    return _font ? TTF_GetFontLineSkip(_font) : 0;
+}
+
+uint64_t GlyphAtlas::getPageBytes() const {
+    return static_cast<uint64_t>(SDL_BYTESPERPIXEL(SDL_PIXELFORMAT_RGBA32)) * _pageSize * _pageSize;
+}
+
+size_t GlyphAtlas::getPageCount() const {
+    return _pages.size();
+}
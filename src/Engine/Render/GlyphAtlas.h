@@ -0,0 +1,41 @@
+#ifndef GLYPHATLAS_H
+#define GLYPHATLAS_H
+#include <Utils/Rect.h>
+#include <SDL3_ttf/SDL_ttf.h>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+struct SDL_Texture;
+
+struct Glyph {
+    SDL_Texture* texture;
+    Rect source;
+    int advance;
+};
+
+class GlyphAtlas {
+    private:
+    TTF_Font* _font;
+    int _pageSize;
+    int _shelfX, _shelfY, _shelfHeight;
+    std::vector<SDL_Texture*> _pages;
+    std::unordered_map<uint32_t, Glyph> _glyphs;
+    std::unordered_map<uint32_t, int> _advances;
+    std::unordered_map<uint64_t, int> _kerning;
+    bool addPage();
+    public:
+    explicit GlyphAtlas(int pageSize = 512);
+    ~GlyphAtlas();
+    void init(TTF_Font* font);
+    void clear();
+    const Glyph* getGlyph(uint32_t codepoint);
+    int getAdvance(uint32_t codepoint);
+    int getKerning(uint32_t previous, uint32_t codepoint);
+    int getLineSkip() const;
+    uint64_t getPageBytes() const;
+    size_t getPageCount() const;
+};
+
+
+#endif //GLYPHATLAS_H
@@ -7,8 +7,9 @@ Rectangle::Rectangle(ComponentData const*data) : ComponentTemplate(data){
 }
 
 bool Rectangle::init() {
-    _color = _data->getData<int>("color",0x000000FF);
-    _size = _data->getVector("size",{1,1});
+    const Data& data = _data->get<Data>();
+    _color = data.color;
+    _size = data.size;
     return RenderComponent::init();
 }
 
@@ -18,3 +19,14 @@ bool Rectangle::render(RenderManager *manager) {
     Rect rectangle = {position.getX(), position.getY(), size.getX(), size.getY()};
     return manager->drawRect(rectangle, _color);
 }
+
+bool Rectangle::getBounds(Rect& bounds) const {
+    bounds = getTransformBounds(_size);
+    return true;
+}
+
+void Rectangle::DeclareSchema(ComponentSchemaTemplate<Data>& schema) {
+    RenderComponent::DeclareSchema(schema);
+    schema.field("color", &Data::color, 0x000000FF)
+        .field("size", &Data::size, Vector2(1, 1));
+}
@@ -9,9 +9,15 @@ class ComponentDerived(Rectangle, RenderComponent) {
     Vector2 _size = {1,1};
     Color _color = {0};
     public:
+    struct Data : RenderComponent::Data {
+        int color;
+        Vector2 size;
+    };
     Rectangle(ComponentData const*data);
+    static void DeclareSchema(ComponentSchemaTemplate<Data>& schema);
     bool init() override;
     bool render(RenderManager* manager) override;
+    bool getBounds(Rect& bounds) const override;
 };
 
 
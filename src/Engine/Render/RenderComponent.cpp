@@ -6,12 +6,20 @@
 #include <Core/Entity.h>
 #include <Core/Scene.h>
 #include <Utils/Error.h>
+#include <cmath>
+#include <numbers>
 
-RenderComponent::RenderComponent(ComponentData const* data): Component(data), _layer(0) {
+RenderComponent::RenderComponent(ComponentData const* data): Component(data), _layer(0), _static(false), _ySort(false) {
+}
+
+RenderComponent::~RenderComponent() {
+    if (_scene) _scene->unregisterRenderComponent(this, _layer);
 }
 
 bool RenderComponent::init() {
-    _layer = _data->getData<int>("layer",0);
+    _layer = _data->get<Data>().layer;
+    _static = _data->get<Data>().isStatic;
+    _ySort = _data->get<Data>().ySort;
     _transform = _entity->getComponent<Transform>();
     if (_transform == nullptr) {
         Error::ShowError("Render object sin transform", "Todos los RenderObjects requieren de un componente Transform para funcionar");
@@ -27,3 +35,53 @@ void RenderComponent::onEnable() {
 void RenderComponent::onDisable() {
     _scene->unregisterRenderComponent(this, _layer);
 }
+
+void RenderComponent::onTransformChanged() {
+    markBoundsDirty();
+}
+
+bool RenderComponent::getBounds(Rect& bounds) const {
+    return false;
+}
+
+int RenderComponent::getLayer() const {
+    return _layer;
+}
+
+bool RenderComponent::isStatic() const {
+    return _static;
+}
+
+bool RenderComponent::isYSorted() const {
+    return _ySort;
+}
+
+float RenderComponent::getSortY() const {
+    Rect bounds;
+    if (getBounds(bounds)) return bounds.y + bounds.h;
+    return _transform ? _transform->getGlobalPosition().getY() : 0;
+}
+
+SDL_Texture* RenderComponent::getTexture() {
+    return nullptr;
+}
+
+Rect RenderComponent::getTransformBounds(const Vector2& size) const {
+    if (!_transform) return {0, 0, 0, 0};
+    Vector2 scaled = _transform->getGlobalScale() * size;
+    Vector2 position = _transform->getGlobalPosition();
+    float radians = _transform->getGlobalRotation() * std::numbers::pi_v<float> / 180.f;
+    float cos = std::abs(std::cos(radians));
+    float sin = std::abs(std::sin(radians));
+    float width = std::abs(scaled.getX()) * cos + std::abs(scaled.getY()) * sin;
+    float height = std::abs(scaled.getX()) * sin + std::abs(scaled.getY()) * cos;
+    return {position.getX() - width / 2.f, position.getY() - height / 2.f, width, height};
+}
+
+void RenderComponent::markBoundsDirty() {
+    if (_scene) _scene->markRenderBoundsDirty(this);
+}
+
+void RenderComponent::markContentDirty() {
+    if (_static) markBoundsDirty();
+}
@@ -1,21 +1,47 @@
 #ifndef RENDERCOMPONENT_H
 #define RENDERCOMPONENT_H
 #include "Core/ComponentTemplate.h"
+#include <Utils/Rect.h>
 
 class RenderManager;
 class Transform;
+struct SDL_Texture;
 
 class RenderComponent : public Component {
     private:
 protected:
     int _layer;
+    bool _static;
+    bool _ySort;
     Transform* _transform {};
+    Rect getTransformBounds(const Vector2& size) const;
+    void markBoundsDirty();
+    void markContentDirty();
     public:
+    struct Data : ComponentFields {
+        int layer;
+        bool isStatic;
+        bool ySort;
+    };
     RenderComponent(ComponentData const* data);
+    template<typename D>
+    static void DeclareSchema(ComponentSchemaTemplate<D>& schema) {
+        schema.field("layer", &Data::layer, 0)
+            .field("static", &Data::isStatic, false)
+            .field("ySort", &Data::ySort, false);
+    }
+    ~RenderComponent() override;
     virtual bool render(RenderManager* manager) = 0;
+    virtual bool getBounds(Rect& bounds) const;
+    int getLayer() const;
+    bool isStatic() const;
+    bool isYSorted() const;
+    float getSortY() const;
+    virtual SDL_Texture* getTexture();
     bool init() override;
     void onEnable() override;
     void onDisable() override;
+    void onTransformChanged() override;
 };
 
 
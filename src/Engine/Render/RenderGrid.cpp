@@ -0,0 +1,110 @@
+#include "RenderGrid.h"
+#include "RenderComponent.h"
+#include <algorithm>
+#include <cmath>
+
+RenderGrid::RenderGrid(float cellSize) : _cellSize(cellSize), _nextOrder(0), _queryStamp(0) {
+}
+
+uint64_t RenderGrid::CellKey(int x, int y) {
+    return static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32 | static_cast<uint32_t>(y);
+}
+
+void RenderGrid::link(Entry* entry) {
+    if (!entry->bounded) {
+        _unbounded.push_back(entry);
+        return;
+    }
+    for (int y = entry->minY; y <= entry->maxY; ++y) {
+        for (int x = entry->minX; x <= entry->maxX; ++x) {
+            _cells[CellKey(x, y)].push_back(entry);
+        }
+    }
+}
+
+void RenderGrid::unlink(Entry* entry) {
+    if (!entry->bounded) {
+        std::erase(_unbounded, entry);
+        return;
+    }
+    for (int y = entry->minY; y <= entry->maxY; ++y) {
+        for (int x = entry->minX; x <= entry->maxX; ++x) {
+            auto cell = _cells.find(CellKey(x, y));
+            if (cell == _cells.end()) continue;
+            std::erase(cell->second, entry);
+            if (cell->second.empty()) _cells.erase(cell);
+        }
+    }
+}
+
+void RenderGrid::insert(RenderComponent* component) {
+    auto [it, inserted] = _entries.insert({component, {component, _nextOrder, false, 0, 0, 0, 0, 0}});
+    if (!inserted) return;
+    ++_nextOrder;
+    link(&it->second);
+}
+
+void RenderGrid::remove(RenderComponent* component) {
+    auto it = _entries.find(component);
+    if (it == _entries.end()) return;
+    unlink(&it->second);
+    _entries.erase(it);
+}
+
+void RenderGrid::update(RenderComponent* component) {
+    auto it = _entries.find(component);
+    if (it == _entries.end()) return;
+    Entry& entry = it->second;
+    Rect bounds;
+    bool bounded = component->getBounds(bounds);
+    int minX = 0, minY = 0, maxX = 0, maxY = 0;
+    if (bounded) {
+        minX = static_cast<int>(std::floor(bounds.x / _cellSize));
+        minY = static_cast<int>(std::floor(bounds.y / _cellSize));
+        maxX = static_cast<int>(std::floor((bounds.x + bounds.w) / _cellSize));
+        maxY = static_cast<int>(std::floor((bounds.y + bounds.h) / _cellSize));
+    }
+    if (bounded == entry.bounded && (!bounded ||
+        (minX == entry.minX && minY == entry.minY && maxX == entry.maxX && maxY == entry.maxY))) {
+        return;
+    }
+    unlink(&entry);
+    entry.bounded = bounded;
+    entry.minX = minX;
+    entry.minY = minY;
+    entry.maxX = maxX;
+    entry.maxY = maxY;
+    link(&entry);
+}
+
+void RenderGrid::query(const Rect& view, std::vector<RenderComponent*>& result) const {
+    ++_queryStamp;
+    std::vector<const Entry*> visible;
+    for (const Entry* entry : _unbounded) {
+        visible.push_back(entry);
+    }
+    int minX = static_cast<int>(std::floor(view.x / _cellSize));
+    int minY = static_cast<int>(std::floor(view.y / _cellSize));
+    int maxX = static_cast<int>(std::floor((view.x + view.w) / _cellSize));
+    int maxY = static_cast<int>(std::floor((view.y + view.h) / _cellSize));
+    for (int y = minY; y <= maxY; ++y) {
+        for (int x = minX; x <= maxX; ++x) {
+            auto cell = _cells.find(CellKey(x, y));
+            if (cell == _cells.end()) continue;
+            for (const Entry* entry : cell->second) {
+                if (entry->queryStamp == _queryStamp) continue;
+                entry->queryStamp = _queryStamp;
+                visible.push_back(entry);
+            }
+        }
+    }
+    std::ranges::sort(visible, {}, &Entry::order);
+    result.clear();
+    for (const Entry* entry : visible) {
+        result.push_back(entry->component);
+    }
+}
+
+bool RenderGrid::empty() const {
+    return _entries.empty();
+}
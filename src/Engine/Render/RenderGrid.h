@@ -0,0 +1,37 @@
+#ifndef RENDERGRID_H
+#define RENDERGRID_H
+#include <Utils/Rect.h>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+class RenderComponent;
+
+class RenderGrid {
+    private:
+    struct Entry {
+        RenderComponent* component;
+        uint32_t order;
+        bool bounded;
+        int minX, minY, maxX, maxY;
+        mutable uint32_t queryStamp;
+    };
+    float _cellSize;
+    uint32_t _nextOrder;
+    mutable uint32_t _queryStamp;
+    std::unordered_map<RenderComponent*, Entry> _entries;
+    std::unordered_map<uint64_t, std::vector<Entry*>> _cells;
+    std::vector<Entry*> _unbounded;
+    static uint64_t CellKey(int x, int y);
+    void link(Entry* entry);
+    void unlink(Entry* entry);
+    public:
+    explicit RenderGrid(float cellSize = 256.f);
+    void insert(RenderComponent* component);
+    void remove(RenderComponent* component);
+    void update(RenderComponent* component);
+    void query(const Rect& view, std::vector<RenderComponent*>& result) const;
+    bool empty() const;
+};
+
+#endif //RENDERGRID_H
@@ -1,15 +1,21 @@
 #include "RenderManager.h"
-#include "TextTexture.h"
 #include "TextureLoader.h"
+#include <SDL3_ttf/SDL_ttf.h>
 #include "Texture.h"
 #include <SDL3/SDL_render.h>
 #include <SDL3/SDL_init.h>
+#include <SDL3/SDL_properties.h>
+#include <Load/FileSystem.h>
+#include <Load/ResourceManager.h>
 #include <Utils/Error.h>
 #include <SDL3_image/SDL_image.h>
+#include <cmath>
+#include <numbers>
 
+constexpr const char* TargetSizeProperty = "RPGBaker.RenderManager.targetSize";
 
-
-RenderManager::RenderManager() : _screenScale(0), _window(nullptr), _renderer(nullptr), _width(0), _height(0) {
+RenderManager::RenderManager() : _screenScale(0), _window(nullptr), _renderer(nullptr), _width(0), _height(0), _batchTexture(nullptr),
+    _virtualTarget(nullptr), _virtualActive(false), _presentScale(1) {
 }
 
 bool RenderManager::init(const int& width, const int& height, std::string const& gameName, std::string const& gameIcon) {
@@ -38,7 +44,8 @@ bool RenderManager::init(const int& width, const int& height, std::string const&
     _screenOffset = {0,0};
     _screenScale = 1;
     if (!gameIcon.empty()) {
-        auto icon = IMG_Load(gameIcon.c_str());
+        SDL_IOStream* file = FileSystem::Open(gameIcon);
+        auto icon = file ? IMG_Load_IO(file, true) : nullptr;
         SDL_SetWindowIcon(_window, icon);
         SDL_DestroySurface(icon);
     }
@@ -46,7 +53,16 @@ bool RenderManager::init(const int& width, const int& height, std::string const&
     return TextureLoader::Init(_renderer);
 }
 
-void RenderManager::present() const {
+void RenderManager::present() {
+    flush();
+    if (_virtualActive) {
+        SDL_SetRenderTarget(_renderer, nullptr);
+        clear();
+        SDL_FRect destination = {_presentOffset.getX(), _presentOffset.getY(),
+            _virtualSize.getX() * _presentScale, _virtualSize.getY() * _presentScale};
+        SDL_RenderTexture(_renderer, _virtualTarget, nullptr, &destination);
+        _virtualActive = false;
+    }
     SDL_RenderPresent(_renderer);
 }
 
@@ -55,26 +71,142 @@ void RenderManager::clear() const {
     SDL_RenderClear(_renderer);
 }
 
-bool RenderManager::drawRect(const Rect &rect, const Color& color) const {
+bool RenderManager::drawRect(const Rect &rect, const Color& color) {
+    Rect drawRect = convertRect(rect);
+    if (drawRect.w == 0 || drawRect.h == 0) {
+        return true;
+    }
+    return batchQuad(nullptr, drawRect, nullptr, 0, {color.r / 255.f, color.g / 255.f, color.b / 255.f, color.a / 255.f});
+}
+
+bool RenderManager::drawSprite(const Rect &rect, const Sprite *sprite, float rotation) {
     Rect drawRect = convertRect(rect);
-    SDL_SetRenderDrawColor(_renderer, color.r, color.g, color.b, color.a);
-    return SDL_RenderFillRect(_renderer, &drawRect);
+    if (drawRect.w == 0 || drawRect.h == 0) {
+        return true;
+    }
+    return batchQuad(sprite->getTexture()->texture, drawRect, &sprite->getRect(), rotation, {1, 1, 1, 1});
 }
 
-bool RenderManager::drawSprite(const Rect &rect, const Sprite *sprite, float rotation) const {
+bool RenderManager::drawText(const Rect &rect, SDL_Texture *texture, const Rect &source, float rotation, const Color& color) {
     Rect drawRect = convertRect(rect);
     if (drawRect.w == 0 || drawRect.h == 0) {
         return true;
     }
-    return SDL_RenderTextureRotated(_renderer, sprite->getTexture()->texture, &sprite->getRect(), &drawRect, rotation, nullptr, SDL_FLIP_NONE);
+    return batchQuad(texture, drawRect, &source, rotation, {color.r / 255.f, color.g / 255.f, color.b / 255.f, color.a / 255.f});
 }
 
-bool RenderManager::drawText(const Rect &rect, const TextTexture *text, float rotation) const {
+bool RenderManager::drawTexture(const Rect &rect, SDL_Texture *texture, float rotation) {
     Rect drawRect = convertRect(rect);
     if (drawRect.w == 0 || drawRect.h == 0) {
         return true;
     }
-    return SDL_RenderTextureRotated(_renderer, text->getTexture(), nullptr, &drawRect, rotation, nullptr, SDL_FLIP_NONE);
+    return batchQuad(texture, drawRect, nullptr, rotation, {1, 1, 1, 1});
+}
+
+bool RenderManager::drawToTarget(SDL_Texture *texture, const Rect &source, const Rect &destination) {
+    return batchQuad(texture, destination, &source, 0, {1, 1, 1, 1});
+}
+
+bool RenderManager::setTarget(SDL_Texture *target) {
+    if (!flush()) {
+        return false;
+    }
+    return SDL_SetRenderTarget(_renderer, target);
+}
+
+SDL_Texture* RenderManager::getTarget() const {
+    return SDL_GetRenderTarget(_renderer);
+}
+
+SDL_Texture* RenderManager::createTarget(int width, int height) {
+    if (!flush()) {
+        return nullptr;
+    }
+    SDL_Texture* texture = TextureLoader::GetTarget(width, height);
+    if (!texture) {
+        return nullptr;
+    }
+    uint64_t size = static_cast<uint64_t>(SDL_BYTESPERPIXEL(texture->format)) * texture->w * texture->h;
+    ResourceManager::ReserveMemory(size);
+    SDL_SetPointerPropertyWithCleanup(SDL_GetTextureProperties(texture), TargetSizeProperty, reinterpret_cast<void*>(static_cast<uintptr_t>(size)),
+        [](void*, void* value) { ResourceManager::ReleaseMemory(reinterpret_cast<uintptr_t>(value)); }, nullptr);
+    return texture;
+}
+
+bool RenderManager::beginCache(SDL_Texture *target, const Rect &area) {
+    _cacheView = {_viewOffset, _screenOffset, _screenScale, _width, _height, getTarget()};
+    if (!setTarget(target)) {
+        return false;
+    }
+    SDL_SetRenderDrawColor(_renderer, 0, 0, 0, 0);
+    SDL_RenderClear(_renderer);
+    _viewOffset = Vector2(area.x, area.y);
+    _screenOffset = Vector2(0, 0);
+    _screenScale = 1;
+    _width = area.w;
+    _height = area.h;
+    return true;
+}
+
+bool RenderManager::endCache() {
+    bool result = setTarget(_cacheView.target);
+    _viewOffset = _cacheView.viewOffset;
+    _screenOffset = _cacheView.screenOffset;
+    _screenScale = _cacheView.screenScale;
+    _width = _cacheView.width;
+    _height = _cacheView.height;
+    return result;
+}
+
+bool RenderManager::batchQuad(SDL_Texture* texture, const Rect& rect, const Rect* source, float rotation, const SDL_FColor& color) {
+    if (texture != _batchTexture || _vertices.empty()) {
+        if (!flush()) {
+            return false;
+        }
+        _batchTexture = texture;
+        float w = 1, h = 1;
+        if (texture && !SDL_GetTextureSize(texture, &w, &h)) {
+            return false;
+        }
+        _batchTextureSize = Vector2(w, h);
+    }
+
+    float u0 = 0, v0 = 0, u1 = 1, v1 = 1;
+    if (source) {
+        u0 = source->x / _batchTextureSize.getX();
+        v0 = source->y / _batchTextureSize.getY();
+        u1 = (source->x + source->w) / _batchTextureSize.getX();
+        v1 = (source->y + source->h) / _batchTextureSize.getY();
+    }
+
+    float radians = rotation * std::numbers::pi_v<float> / 180.f;
+    float cosine = std::cos(radians), sine = std::sin(radians);
+    float halfW = rect.w / 2.f, halfH = rect.h / 2.f;
+    float centerX = rect.x + halfW, centerY = rect.y + halfH;
+    const float corners[4][4] = {
+        {-halfW, -halfH, u0, v0},
+        { halfW, -halfH, u1, v0},
+        { halfW,  halfH, u1, v1},
+        {-halfW,  halfH, u0, v1}
+    };
+
+    int first = static_cast<int>(_vertices.size());
+    for (const auto& [x, y, u, v] : corners) {
+        _vertices.push_back({{centerX + x * cosine - y * sine, centerY + x * sine + y * cosine}, color, {u, v}});
+    }
+    _indices.insert(_indices.end(), {first, first + 1, first + 2, first, first + 2, first + 3});
+    return true;
+}
+
+bool RenderManager::flush() {
+    if (_vertices.empty()) {
+        return true;
+    }
+    bool result = SDL_RenderGeometry(_renderer, _batchTexture, _vertices.data(), static_cast<int>(_vertices.size()),
+        _indices.data(), static_cast<int>(_indices.size()));
+    _vertices.clear();
+    _indices.clear();
+    return result;
 }
 
 void RenderManager::getWindowSize(int *width, int *height) const {
@@ -82,6 +214,7 @@ void RenderManager::getWindowSize(int *width, int *height) const {
 }
 
 void RenderManager::shutdown() const {
+    SDL_DestroyTexture(_virtualTarget);
     SDL_DestroyRenderer(_renderer);
     SDL_DestroyWindow(_window);
     SDL_QuitSubSystem(SDL_INIT_VIDEO);
@@ -100,6 +233,43 @@ std::pair<float, const Vector2&> RenderManager::setViewRect(const Vector2 &viewP
     return std::pair<float, Vector2&>(_screenScale, _screenOffset);
 }
 
+std::pair<float, const Vector2&> RenderManager::setVirtualView(const Vector2 &viewPosition, const Vector2 &viewSize, bool integerScale) {
+    flush();
+    if (!_virtualTarget || _virtualSize != viewSize) {
+        SDL_DestroyTexture(_virtualTarget);
+        _virtualTarget = createTarget(static_cast<int>(std::ceil(viewSize.getX())), static_cast<int>(std::ceil(viewSize.getY())));
+        _virtualSize = viewSize;
+    }
+    if (!_virtualTarget || !SDL_SetRenderTarget(_renderer, _virtualTarget)) {
+        return setViewRect(viewPosition, viewSize);
+    }
+    SDL_SetRenderDrawColor(_renderer, 0, 0, 0, 255);
+    SDL_RenderClear(_renderer);
+    _virtualActive = true;
+
+    int w, h;
+    getWindowSize(&w, &h);
+    _presentScale = std::min(w / viewSize.getX(), h / viewSize.getY());
+    if (integerScale && _presentScale >= 1) _presentScale = std::floor(_presentScale);
+    _presentOffset = Vector2(w - viewSize.getX() * _presentScale, h - viewSize.getY() * _presentScale) / 2.f;
+
+    _viewOffset = viewPosition;
+    _screenOffset = Vector2(0, 0);
+    _screenScale = 1;
+    _width = viewSize.getX();
+    _height = viewSize.getY();
+    return std::pair<float, const Vector2&>(_presentScale, _presentOffset);
+}
+
+Rect RenderManager::getViewRect() const {
+    return {
+        _viewOffset.getX() - _screenOffset.getX() / _screenScale,
+        _viewOffset.getY() - _screenOffset.getY() / _screenScale,
+        _width / _screenScale,
+        _height / _screenScale
+    };
+}
+
 Rect RenderManager::convertRect(const Rect &rect) const {
     Rect tempRect = {
         (rect.x - _viewOffset.getX()) * _screenScale + _screenOffset.getX(),
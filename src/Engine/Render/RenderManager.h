@@ -4,31 +4,57 @@
 #include <Utils/Rect.h>
 #include "Color.h"
 #include "Sprite.h"
-
-struct TextTexture;
-class SDL_Window;
-class SDL_Renderer;
+#include <vector>
+#include <SDL3/SDL_render.h>
 
 class RenderManager {
     public:
     RenderManager();
     bool init(const int& width, const int& height, std::string const& gameName, std::string const& gameIcon);
-    void present() const;
+    void present();
     void clear() const;
-    bool drawRect(const Rect &rect, const Color& color) const;
-    bool drawSprite(const Rect &rect, const Sprite *sprite, float rotation) const;
-    bool drawText(const Rect &rect, const TextTexture *text, float rotation) const;
+    bool drawRect(const Rect &rect, const Color& color);
+    bool drawSprite(const Rect &rect, const Sprite *sprite, float rotation);
+    bool drawText(const Rect &rect, SDL_Texture *texture, const Rect &source, float rotation, const Color& color);
+    bool drawTexture(const Rect &rect, SDL_Texture *texture, float rotation);
+    bool drawToTarget(SDL_Texture *texture, const Rect &source, const Rect &destination);
+    bool setTarget(SDL_Texture *target);
+    SDL_Texture* getTarget() const;
+    SDL_Texture* createTarget(int width, int height);
+    bool beginCache(SDL_Texture *target, const Rect &area);
+    bool endCache();
+    bool flush();
     void getWindowSize(int *width, int *height) const;
     void shutdown() const;
     std::pair<float,const Vector2&> setViewRect(const Vector2& viewPosition, const Vector2& viewSize);
+    std::pair<float,const Vector2&> setVirtualView(const Vector2& viewPosition, const Vector2& viewSize, bool integerScale);
     Rect convertRect(const Rect& rect) const;
+    Rect getViewRect() const;
     private:
+    struct ViewState {
+        Vector2 viewOffset;
+        Vector2 screenOffset;
+        float screenScale;
+        float width, height;
+        SDL_Texture* target;
+    };
+    ViewState _cacheView;
     Vector2 _viewOffset;
     Vector2 _screenOffset;
     float _screenScale;
     SDL_Window* _window;
     SDL_Renderer* _renderer;
     float _width, _height;
+    std::vector<SDL_Vertex> _vertices;
+    std::vector<int> _indices;
+    SDL_Texture* _batchTexture;
+    Vector2 _batchTextureSize;
+    SDL_Texture* _virtualTarget;
+    Vector2 _virtualSize;
+    bool _virtualActive;
+    Vector2 _presentOffset;
+    float _presentScale;
+    bool batchQuad(SDL_Texture* texture, const Rect& rect, const Rect* source, float rotation, const SDL_FColor& color);
 };
 
 #endif //RENDERMANAGER_H
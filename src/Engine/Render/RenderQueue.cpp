@@ -0,0 +1,85 @@
+#include "RenderQueue.h"
+#include "RenderComponent.h"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <limits>
+#include <SDL3/SDL_properties.h>
+#include <SDL3/SDL_render.h>
+
+constexpr const char* TextureIdProperty = "RPGBaker.RenderQueue.textureId";
+
+uint64_t RenderQueue::MakeKey(int layer, bool ySort, float y, uint16_t texture) {
+    int biasedLayer = std::clamp(layer + 0x8000, 0, 0xFFFF);
+    uint32_t sortY = 0;
+    if (ySort) {
+        uint32_t bits = std::bit_cast<uint32_t>(y);
+        sortY = bits & 0x80000000u ? ~bits : bits | 0x80000000u;
+    }
+    return static_cast<uint64_t>(biasedLayer) << 48 | static_cast<uint64_t>(sortY) << 16 | texture;
+}
+
+uint16_t RenderQueue::GetTextureId(SDL_Texture* texture) {
+    if (!texture) return 0;
+    SDL_PropertiesID properties = SDL_GetTextureProperties(texture);
+    if (void* id = SDL_GetPointerProperty(properties, TextureIdProperty, nullptr)) {
+        return static_cast<uint16_t>(reinterpret_cast<uintptr_t>(id));
+    }
+    uint16_t id;
+    if (!_freeTextureIds.empty()) {
+        id = _freeTextureIds.back();
+        _freeTextureIds.pop_back();
+    }
+    else if (_nextTextureId < std::numeric_limits<uint16_t>::max()) {
+        id = ++_nextTextureId;
+    }
+    else {
+        return std::numeric_limits<uint16_t>::max();
+    }
+    SDL_SetPointerPropertyWithCleanup(properties, TextureIdProperty, reinterpret_cast<void*>(static_cast<uintptr_t>(id)), ReleaseTextureId, nullptr);
+    return id;
+}
+
+void RenderQueue::ReleaseTextureId(void*, void* value) {
+    _freeTextureIds.push_back(static_cast<uint16_t>(reinterpret_cast<uintptr_t>(value)));
+}
+
+void RenderQueue::beginFrame() {
+    _items.clear();
+}
+
+void RenderQueue::clear() {
+    _items.clear();
+}
+
+void RenderQueue::push(RenderComponent* component) {
+    uint16_t texture = GetTextureId(component->getTexture());
+    bool ySort = component->isYSorted();
+    _items.push_back({MakeKey(component->getLayer(), ySort, ySort ? component->getSortY() : 0, texture), component});
+}
+
+void RenderQueue::sort() {
+    if (_items.size() < 2) return;
+    _buffer.resize(_items.size());
+    for (int shift = 0; shift < 64; shift += 8) {
+        std::array<size_t, 256> offsets {};
+        for (const Item& item : _items) {
+            ++offsets[item.key >> shift & 0xFF];
+        }
+        if (std::ranges::find(offsets, _items.size()) != offsets.end()) continue;
+        size_t total = 0;
+        for (size_t& offset : offsets) {
+            size_t count = offset;
+            offset = total;
+            total += count;
+        }
+        for (const Item& item : _items) {
+            _buffer[offsets[item.key >> shift & 0xFF]++] = item;
+        }
+        _items.swap(_buffer);
+    }
+}
+
+const std::vector<RenderQueue::Item>& RenderQueue::getItems() const {
+    return _items;
+}
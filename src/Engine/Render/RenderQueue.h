@@ -0,0 +1,32 @@
+#ifndef RENDERQUEUE_H
+#define RENDERQUEUE_H
+#include <cstdint>
+#include <vector>
+
+class RenderComponent;
+struct SDL_Texture;
+
+class RenderQueue {
+    public:
+    struct Item {
+        uint64_t key;
+        RenderComponent* component;
+    };
+    private:
+    std::vector<Item> _items;
+    std::vector<Item> _buffer;
+    static inline std::vector<uint16_t> _freeTextureIds;
+    static inline uint16_t _nextTextureId = 0;
+    static uint16_t GetTextureId(SDL_Texture* texture);
+    static void ReleaseTextureId(void* userdata, void* value);
+    public:
+    static uint64_t MakeKey(int layer, bool ySort, float y, uint16_t texture);
+    void beginFrame();
+    void clear();
+    void push(RenderComponent* component);
+    void sort();
+    const std::vector<Item>& getItems() const;
+};
+
+
+#endif //RENDERQUEUE_H
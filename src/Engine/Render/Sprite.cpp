@@ -22,8 +22,8 @@ bool Sprite::load() {
   sol::table table = LuaReader::GetTable(_path);
   if (!table.valid())
     return false;
-  _texturePath = table.get_or<std::string>("texture", "");
-  if (_texturePath.empty())
+  _texture = ResourceHandler<Texture>::Instance()->request(table.get_or<std::string>("texture", ""));
+  if (_texture.empty())
     return false;
 
   sol::table rect = LuaReader::GetTable(table, "rect");
@@ -38,17 +38,22 @@ bool Sprite::load() {
     return false;
   if (!getRectField(_rect.h, "h", rect))
     return false;
-  _size = 0;
+  _size = sizeof(Sprite);
   return true;
 }
 
 void Sprite::unload() {
-  _texturePath = "";
+  _texture.reset();
   _rect = Rect();
+  _size = 0;
+}
+
+std::string_view Sprite::getBudget() const {
+  return "sprites";
 }
 
 const Texture* Sprite::getTexture() const{
-  return ResourceHandler<Texture>::Instance()->get(_texturePath);
+  return _texture.get();
 }
 
 const Rect & Sprite::getRect() const{
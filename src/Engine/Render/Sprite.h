@@ -2,13 +2,15 @@
 #define SPRITE_H
 #include <Utils/Rect.h>
 #include <string>
+#include <Utils/Symbol.h>
 #include <Load/Resource.h>
+#include <Load/ResourceHandle.h>
 #include <sol/forward.hpp>
 
 class Texture;
 
 class Sprite : public Resource {
-    std::string _texturePath;
+    mutable ResourceHandle<Texture> _texture;
     Rect _rect;
 
     bool getRectField(float& field, std::string const& key, sol::table& rectTable);
@@ -16,6 +18,7 @@ public:
     explicit Sprite(std::string const &path);
     bool load() override;
     void unload() override;
+    std::string_view getBudget() const override;
     const Texture* getTexture() const;
     const Rect& getRect() const;
 };
@@ -1,5 +1,7 @@
 #include "SpriteRenderer.h"
 #include "RenderManager.h"
+#include "Sprite.h"
+#include "Texture.h"
 #include "Transform.h"
 #include <Core/ComponentData.h>
 #include <Load/ResourceHandler.h>
@@ -8,7 +10,7 @@ SpriteRenderer::SpriteRenderer(ComponentData const*data) : ComponentTemplate(dat
 }
 
 bool SpriteRenderer::init() {
-    if (!setSprite(_data->getData<std::string>("sprite")))
+    if (!setSprite(_data->get<Data>().sprite))
         return false;
     return RenderComponent::init();
 }
@@ -16,7 +18,7 @@ bool SpriteRenderer::init() {
 bool SpriteRenderer::render(RenderManager *manager) {
     if (_sprite.empty())
         return true;
-    const Sprite* sprite  = ResourceHandler<Sprite>::Instance()->get(_sprite);
+    const Sprite* sprite = _sprite.get();
     if (!sprite) {return false;}
     Vector2 size = _transform->getGlobalScale() * _size;
     Vector2 position = _transform->getGlobalPosition() - size/2.f;
@@ -24,11 +26,32 @@ bool SpriteRenderer::render(RenderManager *manager) {
     return manager->drawSprite(rectangle, sprite, _transform->getGlobalRotation());
 }
 
-bool SpriteRenderer::setSprite(const std::string& spritePath) {
-    const Sprite* sprite = ResourceHandler<Sprite>::Instance()->get(spritePath);
+bool SpriteRenderer::setSprite(const Symbol& spritePath) {
+    if (_sprite.getKey() == spritePath && _sprite.get())
+        return true;
+    ResourceHandle<Sprite> handle(spritePath);
+    const Sprite* sprite = handle.get();
     if (!sprite)
         return false;
-    _sprite = spritePath;
-    _size = Vector2(sprite->getRect().w, sprite->getRect().h);
+    _sprite = handle;
+    Vector2 size = Vector2(sprite->getRect().w, sprite->getRect().h);
+    if (_size != size) {
+        _size = size;
+        markBoundsDirty();
+    }
+    else markContentDirty();
+    return true;
+}
+
+bool SpriteRenderer::getBounds(Rect& bounds) const {
+    bounds = getTransformBounds(_size);
     return true;
 }
+
+SDL_Texture* SpriteRenderer::getTexture() {
+    if (_sprite.empty()) return nullptr;
+    const Sprite* sprite = _sprite.get();
+    if (!sprite) return nullptr;
+    const Texture* texture = sprite->getTexture();
+    return texture ? texture->texture : nullptr;
+}
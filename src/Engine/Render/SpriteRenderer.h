@@ -2,17 +2,30 @@
 #define SPRITERENDERER_H
 #include "RenderComponent.h"
 #include <Utils/Vector2.h>
-#include <string>
+#include <Utils/Symbol.h>
+#include <Load/ResourceHandle.h>
+
+class Sprite;
 
 class ComponentDerived(SpriteRenderer, RenderComponent) {
     private:
-    std::string _sprite {};
+    ResourceHandle<Sprite> _sprite {};
     Vector2 _size {};
     public:
+    struct Data : RenderComponent::Data {
+        Symbol sprite;
+    };
     SpriteRenderer(ComponentData const*data);
+    template<typename D>
+    static void DeclareSchema(ComponentSchemaTemplate<D>& schema) {
+        RenderComponent::DeclareSchema(schema);
+        schema.field("sprite", &Data::sprite, "");
+    }
     bool init() override;
     bool render(RenderManager* manager) override;
-    bool setSprite(const std::string& spritePath);
+    bool getBounds(Rect& bounds) const override;
+    SDL_Texture* getTexture() override;
+    bool setSprite(const Symbol& spritePath);
 };
 
 
@@ -0,0 +1,115 @@
+#include "StaticLayerCache.h"
+#include "RenderComponent.h"
+#include "RenderManager.h"
+#include <algorithm>
+#include <cmath>
+
+StaticLayerCache::StaticLayerCache(float cellSize) : _cellSize(cellSize), _nextOrder(0) {
+}
+
+StaticLayerCache::~StaticLayerCache() {
+    for (auto& [key, cell] : _cells) {
+        SDL_DestroyTexture(cell.texture);
+    }
+}
+
+uint64_t StaticLayerCache::CellKey(int x, int y) {
+    return static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32 | static_cast<uint32_t>(y);
+}
+
+void StaticLayerCache::invalidate(const Entry& entry) {
+    if (!entry.bounded) return;
+    int minX = static_cast<int>(std::floor(entry.bounds.x / _cellSize));
+    int minY = static_cast<int>(std::floor(entry.bounds.y / _cellSize));
+    int maxX = static_cast<int>(std::floor((entry.bounds.x + entry.bounds.w) / _cellSize));
+    int maxY = static_cast<int>(std::floor((entry.bounds.y + entry.bounds.h) / _cellSize));
+    for (int y = minY; y <= maxY; ++y) {
+        for (int x = minX; x <= maxX; ++x) {
+            auto [it, inserted] = _cells.insert({CellKey(x, y), {nullptr, true}});
+            it->second.dirty = true;
+        }
+    }
+}
+
+void StaticLayerCache::insert(RenderComponent* component) {
+    auto [it, inserted] = _entries.insert({component, {{0, 0, 0, 0}, false, _nextOrder}});
+    if (!inserted) return;
+    ++_nextOrder;
+    it->second.bounded = component->getBounds(it->second.bounds);
+    invalidate(it->second);
+}
+
+void StaticLayerCache::remove(RenderComponent* component) {
+    auto it = _entries.find(component);
+    if (it == _entries.end()) return;
+    invalidate(it->second);
+    _entries.erase(it);
+}
+
+void StaticLayerCache::update(RenderComponent* component) {
+    auto it = _entries.find(component);
+    if (it == _entries.end()) return;
+    invalidate(it->second);
+    it->second.bounded = component->getBounds(it->second.bounds);
+    invalidate(it->second);
+}
+
+bool StaticLayerCache::bake(RenderManager* manager, Cell& cell, const Rect& area) {
+    _bakeList.clear();
+    for (const auto& [component, entry] : _entries) {
+        if (!entry.bounded || !component->isEnabled() || !component->isEntityActive()) continue;
+        if (entry.bounds.x > area.x + area.w || entry.bounds.x + entry.bounds.w < area.x ||
+            entry.bounds.y > area.y + area.h || entry.bounds.y + entry.bounds.h < area.y) continue;
+        _bakeList.emplace_back(entry.order, component);
+    }
+    cell.dirty = false;
+    if (_bakeList.empty()) {
+        SDL_DestroyTexture(cell.texture);
+        cell.texture = nullptr;
+        return true;
+    }
+    std::ranges::sort(_bakeList);
+    if (!cell.texture) {
+        cell.texture = manager->createTarget(static_cast<int>(_cellSize), static_cast<int>(_cellSize));
+        if (!cell.texture) return false;
+    }
+    if (!manager->beginCache(cell.texture, area)) return false;
+    bool result = true;
+    for (const auto& [order, component] : _bakeList) {
+        if (!component->render(manager)) {
+            result = false;
+            break;
+        }
+    }
+    return manager->endCache() && result;
+}
+
+bool StaticLayerCache::render(RenderManager* manager, const Rect& view) {
+    int minX = static_cast<int>(std::floor(view.x / _cellSize));
+    int minY = static_cast<int>(std::floor(view.y / _cellSize));
+    int maxX = static_cast<int>(std::floor((view.x + view.w) / _cellSize));
+    int maxY = static_cast<int>(std::floor((view.y + view.h) / _cellSize));
+    for (int y = minY; y <= maxY; ++y) {
+        for (int x = minX; x <= maxX; ++x) {
+            auto it = _cells.find(CellKey(x, y));
+            if (it == _cells.end()) continue;
+            Rect area = {x * _cellSize, y * _cellSize, _cellSize, _cellSize};
+            if (it->second.dirty && !bake(manager, it->second, area)) return false;
+            if (!it->second.texture) {
+                _cells.erase(it);
+                continue;
+            }
+            if (!manager->drawTexture(area, it->second.texture, 0)) return false;
+        }
+    }
+    for (const auto& [component, entry] : _entries) {
+        if (!entry.bounded && component->isEnabled() && component->isEntityActive() && !component->render(manager)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool StaticLayerCache::empty() const {
+    return _entries.empty();
+}
@@ -0,0 +1,44 @@
+#ifndef STATICLAYERCACHE_H
+#define STATICLAYERCACHE_H
+#include <Utils/Rect.h>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+class RenderComponent;
+class RenderManager;
+struct SDL_Texture;
+
+class StaticLayerCache {
+    private:
+    struct Entry {
+        Rect bounds;
+        bool bounded;
+        uint32_t order;
+    };
+    struct Cell {
+        SDL_Texture* texture;
+        bool dirty;
+    };
+    float _cellSize;
+    uint32_t _nextOrder;
+    std::unordered_map<RenderComponent*, Entry> _entries;
+    std::unordered_map<uint64_t, Cell> _cells;
+    std::vector<std::pair<uint32_t, RenderComponent*>> _bakeList;
+    static uint64_t CellKey(int x, int y);
+    void invalidate(const Entry& entry);
+    bool bake(RenderManager* manager, Cell& cell, const Rect& area);
+    public:
+    explicit StaticLayerCache(float cellSize = 512.f);
+    StaticLayerCache(const StaticLayerCache&) = delete;
+    StaticLayerCache& operator=(const StaticLayerCache&) = delete;
+    ~StaticLayerCache();
+    void insert(RenderComponent* component);
+    void remove(RenderComponent* component);
+    void update(RenderComponent* component);
+    bool render(RenderManager* manager, const Rect& view);
+    bool empty() const;
+};
+
+
+#endif //STATICLAYERCACHE_H
@@ -6,87 +6,223 @@
 #include <Core/ComponentData.h>
 #include <Utils/Rect.h>
 #include <Utils/Error.h>
+#include <Utils/UTF8.h>
+#include <algorithm>
+#include <cmath>
+#include <numbers>
 
 
-bool Text::remakeTexture() {
-    delete _texture;
-    const Font* font = ResourceHandler<Font>::Instance()->get(std::to_string(_fontSize)+_font);
-    if (!font) {
-        _texture = nullptr;
-        return false;
+bool Text::resetFont() {
+    _fontResource.reset(std::to_string(_fontSize) + _font);
+    return relayout();
+}
+
+bool Text::relayout() {
+    _glyphs.clear();
+    _laidOutBytes = 0;
+    _penX = _penY = 0;
+    _wordStart = 0;
+    _wordStartX = 0;
+    _inWord = false;
+    _previous = 0;
+    const Font* font = _fontResource.get();
+    if (!font) return false;
+    _layoutGeneration = font->getGeneration();
+    layoutText(font);
+    markContentDirty();
+    return true;
+}
+
+void Text::layoutText(const Font* font) {
+    uint32_t codepoint;
+    while (UTF8::Decode(_text, _laidOutBytes, codepoint)) {
+        layoutCodepoint(codepoint, font);
+    }
+}
+
+void Text::layoutCodepoint(uint32_t codepoint, const Font* font) {
+    float lineSkip = static_cast<float>(font->getLineSkip());
+    if (codepoint == '\n') {
+        _penX = 0;
+        _penY += lineSkip;
+        _inWord = false;
+        _previous = 0;
+        return;
+    }
+    const Glyph* glyph = font->getGlyph(codepoint);
+    if (!glyph) return;
+    float x = _penX + (_previous ? font->getKerning(_previous, codepoint) : 0);
+    _previous = codepoint;
+    if (codepoint == ' ' || codepoint == '\t') {
+        _penX = x + glyph->advance;
+        _inWord = false;
+        return;
+    }
+    if (!_inWord) {
+        _inWord = true;
+        _wordStart = _glyphs.size();
+        _wordStartX = x;
     }
-    _texture = new TextTexture(font, _color, _text, _size.getX(), _size.getY(), _centerText);
-    return _texture->getTexture() != nullptr;
+    if (x > 0 && x + glyph->source.w > _size.getX()) {
+        if (_wordStartX <= 0) {
+            _wordStart = _glyphs.size();
+            _wordStartX = x;
+        }
+        for (size_t i = _wordStart; i < _glyphs.size(); ++i) {
+            _glyphs[i].destination.x -= _wordStartX;
+            _glyphs[i].destination.y += lineSkip;
+        }
+        x -= _wordStartX;
+        _penY += lineSkip;
+        _wordStartX = 0;
+    }
+    if (glyph->texture) {
+        _glyphs.push_back({glyph->texture, glyph->source, {x, _penY, glyph->source.w, glyph->source.h}});
+    }
+    _penX = x + glyph->advance;
 }
 
 Text::Text(ComponentData const *data) :
     ComponentTemplate(data),
-    _texture(nullptr),
     _fontSize(12),
     _size(1, 1),
-    _centerText(false) {
+    _centerText(false),
+    _laidOutBytes(0),
+    _penX(0),
+    _penY(0),
+    _wordStart(0),
+    _wordStartX(0),
+    _inWord(false),
+    _previous(0),
+    _layoutGeneration(0) {
 }
 
 bool Text::init() {
-    _text = _data->getData<std::string>("text");
-    _font = _data->getData<std::string>("font");
-    _fontSize = _data->getData<int>("fontSize",12);
-    _color = _data->getData<int>("color",0xFFFFFFFF);
-    _centerText = _data->getData<bool>("centerText",false);
-    _size = _data->getVector("size",{100,100});
-    if (!remakeTexture()) return false;
+    const Data& data = _data->get<Data>();
+    _text = data.text;
+    _font = data.font;
+    _fontSize = data.fontSize;
+    _color = data.color;
+    _centerText = data.centerText;
+    _size = data.size;
+    if (!resetFont()) return false;
     return RenderComponent::init();
 }
 
 bool Text::render(RenderManager *manager) {
-    Vector2 size = _transform->getGlobalScale() * _size;
-    Vector2 position = _transform->getGlobalPosition() - size/2.f;
-    Rect rectangle = {position.getX(), position.getY(), size.getX(), size.getY()};
-    return manager->drawText(rectangle, _texture, _transform->getGlobalRotation());
+    const Font* font = _fontResource.get();
+    if (!font) return false;
+    if (font->getGeneration() != _layoutGeneration && !relayout()) return false;
+
+    Vector2 offset = Vector2(0, 0) - _size / 2.f;
+    if (_centerText && !_glyphs.empty()) {
+        float width = 0;
+        for (const GlyphQuad& glyph : _glyphs) {
+            width = std::max(width, glyph.destination.x + glyph.destination.w);
+        }
+        float height = _penY + font->getLineSkip();
+        offset += Vector2(std::max(0.f, _size.getX() - width), std::max(0.f, _size.getY() - height)) / 2.f;
+    }
+
+    Vector2 scale = _transform->getGlobalScale();
+    Vector2 center = _transform->getGlobalPosition();
+    float rotation = _transform->getGlobalRotation();
+    float radians = rotation * std::numbers::pi_v<float> / 180.f;
+    float cosine = std::cos(radians), sine = std::sin(radians);
+    for (const GlyphQuad& glyph : _glyphs) {
+        Rect source = glyph.source;
+        Rect destination = glyph.destination;
+        float overflowX = destination.x + destination.w - _size.getX();
+        float overflowY = destination.y + destination.h - _size.getY();
+        if (overflowX >= destination.w || overflowY >= destination.h) continue;
+        if (overflowX > 0) {
+            destination.w -= overflowX;
+            source.w -= overflowX;
+        }
+        if (overflowY > 0) {
+            destination.h -= overflowY;
+            source.h -= overflowY;
+        }
+        Vector2 local = (offset + Vector2(destination.x + destination.w / 2.f, destination.y + destination.h / 2.f)) * scale;
+        Vector2 size = Vector2(destination.w, destination.h) * scale;
+        Vector2 position = center + Vector2(local.getX() * cosine - local.getY() * sine, local.getX() * sine + local.getY() * cosine) - size / 2.f;
+        Rect rectangle = {position.getX(), position.getY(), size.getX(), size.getY()};
+        if (!manager->drawText(rectangle, glyph.texture, source, rotation, _color)) return false;
+    }
+    return true;
+}
+
+bool Text::getBounds(Rect& bounds) const {
+    bounds = getTransformBounds(_size);
+    return true;
+}
+
+SDL_Texture* Text::getTexture() {
+    return _glyphs.empty() ? nullptr : _glyphs.front().texture;
 }
 
 bool Text::setText(const std::string &text) {
     if (_text == text) return true;
+    const Font* font = _fontResource.get();
+    if (font && font->getGeneration() == _layoutGeneration && text.starts_with(_text)) {
+        _text = text;
+        layoutText(font);
+        markContentDirty();
+        return true;
+    }
     _text = text;
-    return remakeTexture();
+    return relayout();
+}
+
+bool Text::appendText(std::string_view text) {
+    if (text.empty()) return true;
+    _text.append(text);
+    const Font* font = _fontResource.get();
+    if (!font || font->getGeneration() != _layoutGeneration) return relayout();
+    layoutText(font);
+    markContentDirty();
+    return true;
 }
 
 bool Text::setFont(const std::string &font) {
     if (_font == font) return true;
     _font = font;
-    return remakeTexture();
+    return resetFont();
 }
 
 bool Text::setFontSize(int fontSize) {
     if (_fontSize == fontSize) return true;
     _fontSize = fontSize;
-    return remakeTexture();
+    return resetFont();
 }
 
 bool Text::setColor(const Color &color) {
     if (_color == color) return true;
     _color = color;
-    return remakeTexture();
+    markContentDirty();
+    return true;
 }
 
 bool Text::setSize(const Vector2 &size) {
     if (_size == size) return true;
     _size = size;
-    return remakeTexture();
+    markBoundsDirty();
+    return relayout();
 }
 
 bool Text::setCenterText(bool center) {
     if (_centerText == center) return true;
     _centerText = center;
-    return remakeTexture();
+    markContentDirty();
+    return true;
 }
 
 const std::string& Text::getText() const {
     return _text;
 }
 
-std::string Text::getFont() const {
-    return std::to_string(_fontSize)+_font;
+const Symbol& Text::getFont() const {
+    return _fontResource.getKey();
 }
 
 const Vector2 & Text::getSize() const {
@@ -98,3 +234,13 @@ void Text::RegisterToLua(sol::state &lua) {
     type["setText"] = &Text::setText;
     type["get"] = &Text::get;
 }
+
+void Text::DeclareSchema(ComponentSchemaTemplate<Data>& schema) {
+    RenderComponent::DeclareSchema(schema);
+    schema.field("text", &Data::text)
+        .field("font", &Data::font)
+        .field("fontSize", &Data::fontSize, 12)
+        .field("color", &Data::color, 0xFFFFFFFF)
+        .field("centerText", &Data::centerText, false)
+        .field("size", &Data::size, Vector2(100, 100));
+}
@@ -1,30 +1,66 @@
 #ifndef TEXT_H
 #define TEXT_H
-#include "TextTexture.h"
+#include "Color.h"
 #include "RenderComponent.h"
+#include <Load/ResourceHandle.h>
+#include <Utils/Symbol.h>
 #include <Utils/Vector2.h>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+class Font;
+struct SDL_Texture;
 
 class ComponentDerived(Text, RenderComponent) {
-    TextTexture* _texture;
+    struct GlyphQuad {
+        SDL_Texture* texture;
+        Rect source;
+        Rect destination;
+    };
     std::string _text;
     std::string _font;
+    ResourceHandle<Font> _fontResource;
     int _fontSize;
     Color _color;
     Vector2 _size;
     bool _centerText;
-    bool remakeTexture();
+    std::vector<GlyphQuad> _glyphs;
+    size_t _laidOutBytes;
+    float _penX, _penY;
+    size_t _wordStart;
+    float _wordStartX;
+    bool _inWord;
+    uint32_t _previous;
+    uint32_t _layoutGeneration;
+    bool resetFont();
+    bool relayout();
+    void layoutText(const Font* font);
+    void layoutCodepoint(uint32_t codepoint, const Font* font);
     public:
+    struct Data : RenderComponent::Data {
+        std::string text;
+        std::string font;
+        int fontSize;
+        int color;
+        bool centerText;
+        Vector2 size;
+    };
     Text(ComponentData const*data);
+    static void DeclareSchema(ComponentSchemaTemplate<Data>& schema);
     bool init() override;
     bool render(RenderManager* manager) override;
+    bool getBounds(Rect& bounds) const override;
+    SDL_Texture* getTexture() override;
     bool setText(const std::string& text);
+    bool appendText(std::string_view text);
     bool setFont(const std::string& font);
     bool setFontSize(int fontSize);
     bool setColor(const Color& color);
     bool setSize(const Vector2& size);
     bool setCenterText(bool center);
     const std::string& getText() const;
-    std::string getFont() const;
+    const Symbol& getFont() const;
     const Vector2& getSize() const;
 
     static void RegisterToLua(sol::state &lua);
@@ -0,0 +1,89 @@
+#include "TextLayout.h"
+#include "Font.h"
+#include <Utils/UTF8.h>
+#include <algorithm>
+#include <cstdint>
+
+void TextLayout::addLine(TextSpan line, size_t maxLines, bool& newParagraph) {
+    if (newParagraph || _paragraphs.back().lastLine - _paragraphs.back().firstLine >= maxLines) {
+        _paragraphs.push_back({_lines.size(), _lines.size()});
+        newParagraph = false;
+    }
+    _lines.push_back(line);
+    _paragraphs.back().lastLine = _lines.size();
+}
+
+void TextLayout::layout(const Font* font, std::string_view text, size_t begin, float maxWidth, float maxHeight) {
+    int lineSkip = std::max(1, font->getLineSkip());
+    size_t maxLines = std::max(1, static_cast<int>(maxHeight) / lineSkip);
+    bool newParagraph = true;
+
+    size_t lineStart = begin;
+    size_t breakBegin = std::string_view::npos, breakEnd = std::string_view::npos;
+    float width = 0, widthAtBreakEnd = 0;
+    bool lineEmpty = true, inSpace = false;
+    uint32_t previous = 0;
+
+    size_t position = begin;
+    uint32_t codepoint;
+    for (size_t next = position; UTF8::Decode(text, next, codepoint); position = next) {
+        if (codepoint == '\n') {
+            if (!lineEmpty) addLine({lineStart, inSpace ? breakBegin : position}, maxLines, newParagraph);
+            newParagraph = true;
+            lineStart = next;
+            breakBegin = breakEnd = std::string_view::npos;
+            width = 0;
+            lineEmpty = true;
+            inSpace = false;
+            previous = 0;
+            continue;
+        }
+        bool space = codepoint == ' ' || codepoint == '\t';
+        if (lineEmpty) {
+            if (space) {
+                lineStart = next;
+                continue;
+            }
+            lineEmpty = false;
+        }
+        if (space) {
+            if (!inSpace) breakBegin = position;
+            inSpace = true;
+        }
+        else if (inSpace) {
+            breakEnd = position;
+            widthAtBreakEnd = width;
+            inSpace = false;
+        }
+
+        width += (previous ? font->getKerning(previous, codepoint) : 0) + font->getAdvance(codepoint);
+        previous = codepoint;
+        if (space || width <= maxWidth) continue;
+
+        if (breakEnd != std::string_view::npos && breakEnd > lineStart) {
+            addLine({lineStart, breakBegin}, maxLines, newParagraph);
+            lineStart = breakEnd;
+            width -= widthAtBreakEnd;
+        }
+        else if (position > lineStart) {
+            addLine({lineStart, position}, maxLines, newParagraph);
+            lineStart = position;
+            width = static_cast<float>(font->getAdvance(codepoint));
+        }
+        breakBegin = breakEnd = std::string_view::npos;
+    }
+    if (!lineEmpty) addLine({lineStart, inSpace ? breakBegin : position}, maxLines, newParagraph);
+}
+
+void TextLayout::clear() {
+    _lines.clear();
+    _paragraphs.clear();
+}
+
+const std::vector<TextSpan>& TextLayout::getLines() const {
+    return _lines;
+}
+
+const std::vector<TextLayout::Paragraph>& TextLayout::getParagraphs() const {
+    return _paragraphs;
+}
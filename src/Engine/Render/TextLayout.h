@@ -0,0 +1,32 @@
+#ifndef TEXTLAYOUT_H
+#define TEXTLAYOUT_H
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+class Font;
+
+struct TextSpan {
+    size_t begin;
+    size_t end;
+};
+
+class TextLayout {
+    public:
+    struct Paragraph {
+        size_t firstLine;
+        size_t lastLine;
+    };
+    private:
+    std::vector<TextSpan> _lines;
+    std::vector<Paragraph> _paragraphs;
+    void addLine(TextSpan line, size_t maxLines, bool& newParagraph);
+    public:
+    void layout(const Font* font, std::string_view text, size_t begin, float maxWidth, float maxHeight);
+    void clear();
+    const std::vector<TextSpan>& getLines() const;
+    const std::vector<Paragraph>& getParagraphs() const;
+};
+
+
+#endif //TEXTLAYOUT_H
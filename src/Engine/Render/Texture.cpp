@@ -2,16 +2,29 @@
 #include "TextureLoader.h"
 #include "SDL3/SDL_render.h"
 
-Texture::Texture(std::string const &path) : Resource(path), texture(nullptr){
+Texture::Texture(std::string const &path) : Resource(path), _surface(nullptr), texture(nullptr){
+}
+
+void Texture::prepare() {
+  _surface = TextureLoader::GetSurface(_path);
 }
 
 bool Texture::load() {
-  texture = TextureLoader::GetTexture(_path);
+  texture = TextureLoader::GetTexture(_surface);
+  _surface = nullptr;
   if (texture)
-      _size = texture->w * texture->h;
+      _size = static_cast<uint64_t>(SDL_BYTESPERPIXEL(texture->format)) * texture->w * texture->h;
   return texture;
 }
 
 void Texture::unload() {
+  SDL_DestroySurface(_surface);
+  _surface = nullptr;
   SDL_DestroyTexture(texture);
+  texture = nullptr;
+  _size = 0;
+}
+
+std::string_view Texture::getBudget() const {
+  return "textures";
 }
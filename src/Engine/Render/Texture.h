@@ -4,13 +4,18 @@
 #include <Load/Resource.h>
 
 class SDL_Texture;
+struct SDL_Surface;
 
 class Texture : public Resource {
+    private:
+    SDL_Surface* _surface;
     public:
     SDL_Texture* texture;
     explicit Texture(std::string const &path);
+    void prepare() override;
     bool load() override;
     void unload() override;
+    std::string_view getBudget() const override;
 };
 
 
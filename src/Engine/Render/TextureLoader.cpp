@@ -1,16 +1,11 @@
 #include "TextureLoader.h"
 #include "Color.h"
+#include <Load/FileSystem.h>
 #include <Utils/Error.h>
 #include <SDL3/SDL_render.h>
 #include <SDL3_image/SDL_image.h>
 #include <SDL3_ttf/SDL_ttf.h>
-
-#include <SDL3/SDL.h>
-#ifdef __APPLE__
-#define GetCurrentDir strdup(SDL_GetBasePath())
-#else
-#define GetCurrentDir SDL_GetCurrentDirectory()
-#endif
+#include <vector>
 
 SDL_Renderer* TextureLoader::_renderer = nullptr;
 
@@ -36,14 +31,14 @@ SDL_Texture* TextureLoader::GetTexture(const Color& color) {
 }
 
 SDL_Texture* TextureLoader::GetTexture(const std::string& filePath) {
-#ifdef __APPLE__
-    auto currDir = GetCurrentDir;
-    std::string path = currDir + filePath;
-    SDL_free(currDir);
-#else
-    std::string path = filePath;
-#endif
-    return GetTexture(IMG_Load(path.c_str()));
+    return GetTexture(GetSurface(filePath));
+}
+
+SDL_Surface* TextureLoader::GetSurface(const std::string& filePath) {
+    SDL_IOStream* file = FileSystem::Open(filePath);
+    if (!file)
+        return nullptr;
+    return IMG_Load_IO(file, true);
 }
 
 SDL_Texture * TextureLoader::GetTexture(SDL_Surface *surface) {
@@ -62,25 +57,33 @@ SDL_Texture * TextureLoader::GetTexture(SDL_Surface *surface) {
     return texture;
 }
 
-void TextureLoader::ResizeTexture(SDL_Texture*& texture, int width, int height, bool centered) {
-    if (!_renderer) return;
-    SDL_Texture* newTexture = SDL_CreateTexture(_renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, width, height);
-    if (!newTexture) {
+SDL_Texture* TextureLoader::GetTarget(int width, int height) {
+    if (!_renderer) return nullptr;
+    SDL_Texture* texture = SDL_CreateTexture(_renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, width, height);
+    if (!texture) {
         Error::ShowError("Error al crear textura vacía", SDL_GetError());
-        return;
+        return nullptr;
     }
-    SDL_SetTextureScaleMode(newTexture, SDL_SCALEMODE_NEAREST);
-    SDL_SetRenderTarget(_renderer, newTexture);
+    SDL_SetTextureScaleMode(texture, SDL_SCALEMODE_NEAREST);
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    SDL_Texture* previous = SDL_GetRenderTarget(_renderer);
+    SDL_SetRenderTarget(_renderer, texture);
     SDL_SetRenderDrawColor(_renderer, 0, 0, 0, 0);
     SDL_RenderClear(_renderer);
-    SDL_FRect srcRect = {0, 0, static_cast<float>(std::min(texture->w, width)), static_cast<float>(std::min(texture->h, height))};
-    SDL_FRect dstRect = {0, 0, srcRect.w, srcRect.h};
-    if (centered) {
-        dstRect.x = (width - dstRect.w) / 2.0f;
-        dstRect.y = (height - dstRect.h) / 2.0f;
+    SDL_SetRenderTarget(_renderer, previous);
+    return texture;
+}
+
+SDL_Texture* TextureLoader::GetBlank(int width, int height) {
+    if (!_renderer) return nullptr;
+    SDL_Texture* texture = SDL_CreateTexture(_renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, width, height);
+    if (!texture) {
+        Error::ShowError("Error al crear textura vacía", SDL_GetError());
+        return nullptr;
     }
-    SDL_RenderTexture(_renderer, texture, &srcRect, &dstRect);
-    SDL_SetRenderTarget(_renderer, nullptr);
-    SDL_DestroyTexture(texture);
-    texture = newTexture;
+    std::vector<uint32_t> pixels(static_cast<size_t>(width) * height, 0);
+    SDL_UpdateTexture(texture, nullptr, pixels.data(), width * static_cast<int>(sizeof(uint32_t)));
+    SDL_SetTextureScaleMode(texture, SDL_SCALEMODE_NEAREST);
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    return texture;
 }
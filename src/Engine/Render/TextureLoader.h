@@ -16,7 +16,9 @@ class TextureLoader {
     static SDL_Texture* GetTexture(const Color& color);
     static SDL_Texture* GetTexture(const std::string& filePath);
     static SDL_Texture* GetTexture(SDL_Surface* surface);
-    static void ResizeTexture(SDL_Texture *&texture, int width, int height, bool centered);
+    static SDL_Surface* GetSurface(const std::string& filePath);
+    static SDL_Texture* GetTarget(int width, int height);
+    static SDL_Texture* GetBlank(int width, int height);
 };
 
 
@@ -0,0 +1,144 @@
+#include "TilemapRenderer.h"
+#include "RenderManager.h"
+#include "Texture.h"
+#include "Tileset.h"
+#include "Transform.h"
+#include <Core/ComponentData.h>
+#include <Load/ResourceHandler.h>
+#include <Utils/Error.h>
+#include <SDL3/SDL_render.h>
+#include <algorithm>
+
+TilemapRenderer::TilemapRenderer(ComponentData const* data) :
+    ComponentTemplate(data),
+    _width(0),
+    _height(0),
+    _chunkSize(1),
+    _chunksX(0),
+    _chunksY(0) {
+}
+
+TilemapRenderer::~TilemapRenderer() {
+    releaseChunks();
+}
+
+void TilemapRenderer::releaseChunks() {
+    for (SDL_Texture*& chunk : _chunks) {
+        SDL_DestroyTexture(chunk);
+        chunk = nullptr;
+    }
+}
+
+bool TilemapRenderer::init() {
+    const Data& data = _data->get<Data>();
+    _width = data.width;
+    _height = data.height;
+    _chunkSize = std::max(data.chunkSize, 1);
+    _tileSize = data.tileSize;
+    _tiles = data.tiles;
+    if (_width <= 0 || _height <= 0 || _tiles.size() != static_cast<size_t>(_width * _height)) {
+        Error::ShowError("Tilemap inválido", "El número de tiles no coincide con las dimensiones del tilemap");
+        return false;
+    }
+
+    int nextId = 1;
+    for (const std::string& path : data.tilesets) {
+        ResourceHandle<Tileset>& handle = _tilesets.emplace_back(path);
+        const Tileset* tileset = handle.get();
+        if (!tileset) {
+            Error::ShowError("Tilemap inválido", "No se pudo cargar el tileset " + path);
+            return false;
+        }
+        _firstIds.push_back(nextId);
+        nextId += tileset->getTileCount();
+    }
+
+    _chunksX = (_width + _chunkSize - 1) / _chunkSize;
+    _chunksY = (_height + _chunkSize - 1) / _chunkSize;
+    _chunks.assign(_chunksX * _chunksY, nullptr);
+    _emptyChunks.assign(_chunksX * _chunksY, true);
+    for (int y = 0; y < _height; ++y) {
+        for (int x = 0; x < _width; ++x) {
+            if (_tiles[y * _width + x] != 0) {
+                _emptyChunks[(y / _chunkSize) * _chunksX + x / _chunkSize] = false;
+            }
+        }
+    }
+    return RenderComponent::init();
+}
+
+void TilemapRenderer::onDisable() {
+    RenderComponent::onDisable();
+    releaseChunks();
+}
+
+bool TilemapRenderer::render(RenderManager* manager) {
+    Vector2 tileSize = _transform->getGlobalScale() * _tileSize;
+    Vector2 origin = _transform->getGlobalPosition() - Vector2(_width / 2.f + 0.5f, _height / 2.f + 0.5f) * tileSize;
+    for (int chunkY = 0; chunkY < _chunksY; ++chunkY) {
+        for (int chunkX = 0; chunkX < _chunksX; ++chunkX) {
+            int chunk = chunkY * _chunksX + chunkX;
+            if (_emptyChunks[chunk]) continue;
+            int tilesX = std::min(_chunkSize, _width - chunkX * _chunkSize);
+            int tilesY = std::min(_chunkSize, _height - chunkY * _chunkSize);
+            Vector2 position = origin + Vector2(chunkX * _chunkSize, chunkY * _chunkSize) * tileSize;
+            Vector2 size = Vector2(tilesX, tilesY) * tileSize;
+            Rect rectangle = {position.getX(), position.getY(), size.getX(), size.getY()};
+            if (manager->convertRect(rectangle).w == 0) continue;
+            if (!_chunks[chunk] && !bakeChunk(manager, chunkX, chunkY, tilesX, tilesY)) return false;
+            if (!manager->drawTexture(rectangle, _chunks[chunk], 0)) return false;
+        }
+    }
+    return true;
+}
+
+bool TilemapRenderer::getBounds(Rect& bounds) const {
+    if (!_transform) return false;
+    Vector2 tileSize = _transform->getGlobalScale() * _tileSize;
+    Vector2 origin = _transform->getGlobalPosition() - Vector2(_width / 2.f + 0.5f, _height / 2.f + 0.5f) * tileSize;
+    Vector2 size = Vector2(_width, _height) * tileSize;
+    bounds = {origin.getX(), origin.getY(), size.getX(), size.getY()};
+    return true;
+}
+
+bool TilemapRenderer::bakeChunk(RenderManager* manager, int chunkX, int chunkY, int tilesX, int tilesY) {
+    SDL_Texture*& chunk = _chunks[chunkY * _chunksX + chunkX];
+    SDL_Texture* previous = manager->getTarget();
+    chunk = manager->createTarget(tilesX * _tileSize.getX(), tilesY * _tileSize.getY());
+    if (!chunk || !manager->setTarget(chunk)) return false;
+
+    std::vector<const Tileset*> tilesets;
+    tilesets.reserve(_tilesets.size());
+    for (ResourceHandle<Tileset>& handle : _tilesets) {
+        tilesets.push_back(handle.get());
+    }
+
+    bool result = true;
+    for (int y = 0; y < tilesY && result; ++y) {
+        for (int x = 0; x < tilesX && result; ++x) {
+            int id = _tiles[(chunkY * _chunkSize + y) * _width + chunkX * _chunkSize + x];
+            if (id == 0) continue;
+            size_t slot = std::ranges::upper_bound(_firstIds, id) - _firstIds.begin();
+            if (slot == 0) continue;
+            const Tileset* tileset = tilesets[slot - 1];
+            const Texture* texture = tileset ? tileset->getTexture() : nullptr;
+            if (!texture) {
+                result = false;
+                break;
+            }
+            Rect destination = {x * _tileSize.getX(), y * _tileSize.getY(), _tileSize.getX(), _tileSize.getY()};
+            result = manager->drawToTarget(texture->texture, tileset->getTileRect(id - _firstIds[slot - 1]), destination);
+        }
+    }
+    return manager->setTarget(previous) && result;
+}
+
+void TilemapRenderer::DeclareSchema(ComponentSchemaTemplate<Data>& schema) {
+    RenderComponent::DeclareSchema(schema);
+    schema.field("width", &Data::width, 0)
+        .field("height", &Data::height, 0)
+        .field("chunkSize", &Data::chunkSize, 16)
+        .field("tileSize", &Data::tileSize, Vector2(1, 1))
+        .field("tilesets", &Data::tilesets)
+        .field("tiles", &Data::tiles);
+}
@@ -0,0 +1,45 @@
+#ifndef TILEMAPRENDERER_H
+#define TILEMAPRENDERER_H
+#include "RenderComponent.h"
+#include <Load/ResourceHandle.h>
+#include <Utils/Vector2.h>
+#include <string>
+#include <vector>
+
+class Tileset;
+struct SDL_Texture;
+
+class ComponentDerived(TilemapRenderer, RenderComponent) {
+    private:
+    int _width;
+    int _height;
+    int _chunkSize;
+    int _chunksX;
+    int _chunksY;
+    Vector2 _tileSize;
+    std::vector<ResourceHandle<Tileset>> _tilesets;
+    std::vector<int> _firstIds;
+    std::vector<int> _tiles;
+    std::vector<SDL_Texture*> _chunks;
+    std::vector<bool> _emptyChunks;
+    void releaseChunks();
+    bool bakeChunk(RenderManager* manager, int chunkX, int chunkY, int tilesX, int tilesY);
+    public:
+    struct Data : RenderComponent::Data {
+        int width;
+        int height;
+        int chunkSize;
+        Vector2 tileSize;
+        std::vector<std::string> tilesets;
+        std::vector<int> tiles;
+    };
+    TilemapRenderer(ComponentData const* data);
+    static void DeclareSchema(ComponentSchemaTemplate<Data>& schema);
+    ~TilemapRenderer() override;
+    bool init() override;
+    void onDisable() override;
+    bool render(RenderManager* manager) override;
+    bool getBounds(Rect& bounds) const override;
+};
+
+#endif //TILEMAPRENDERER_H
@@ -0,0 +1,63 @@
+#include "Tileset.h"
+
+#include <Load/LuaReader.h>
+#include <Load/ResourceHandler.h>
+#include <Utils/Error.h>
+
+#include "Texture.h"
+
+Tileset::Tileset(std::string const &path) :
+  Resource(path),
+  _columns(0),
+  _rows(0) {
+}
+
+bool Tileset::load() {
+  sol::table table = LuaReader::GetTable(_path);
+  if (!table.valid()) {
+    Error::ShowError("Tileset not found", "Could not find tileset with name: \"" + _path + "\".");
+    return false;
+  }
+  _texture = ResourceHandler<Texture>::Instance()->request(table.get_or<std::string>("texture", ""));
+  if (_texture.empty())
+    return false;
+
+  _columns = table.get_or("columns", 0);
+  _rows = table.get_or("rows", 0);
+  if (_columns <= 0 || _rows <= 0)
+    return false;
+  _tileSize = Vector2(table.get_or("tileWidth", 0.0f), table.get_or("tileHeight", 0.0f));
+  if (_tileSize.getX() <= 0 || _tileSize.getY() <= 0)
+    return false;
+  _offset = Vector2(table.get_or("offsetX", 0.0f), table.get_or("offsetY", 0.0f));
+  _size = sizeof(Tileset);
+  return true;
+}
+
+void Tileset::unload() {
+  _texture.reset();
+  _columns = 0;
+  _rows = 0;
+  _size = 0;
+}
+
+std::string_view Tileset::getBudget() const {
+  return "tilesets";
+}
+
+const Texture* Tileset::getTexture() const {
+  return _texture.get();
+}
+
+int Tileset::getTileCount() const {
+  return _columns * _rows;
+}
+
+Rect Tileset::getTileRect(int index) const {
+  return {
+    (index % _columns) * _tileSize.getX() + _offset.getX(),
+    (index / _columns) * _tileSize.getY() + _offset.getY(),
+    _tileSize.getX(),
+    _tileSize.getY()
+  };
+}
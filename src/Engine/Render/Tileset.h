@@ -0,0 +1,27 @@
+#ifndef TILESET_H
+#define TILESET_H
+#include <Load/Resource.h>
+#include <Load/ResourceHandle.h>
+#include <Utils/Rect.h>
+#include <Utils/Symbol.h>
+#include <Utils/Vector2.h>
+
+class Texture;
+
+class Tileset : public Resource {
+    mutable ResourceHandle<Texture> _texture;
+    int _columns;
+    int _rows;
+    Vector2 _tileSize;
+    Vector2 _offset;
+public:
+    explicit Tileset(std::string const &path);
+    bool load() override;
+    void unload() override;
+    std::string_view getBudget() const override;
+    const Texture* getTexture() const;
+    int getTileCount() const;
+    Rect getTileRect(int index) const;
+};
+
+#endif //TILESET_H
@@ -2,57 +2,93 @@
 #include <Core/ComponentData.h>
 #include <Core/Entity.h>
 
-Transform::Transform(ComponentData const*data) : ComponentTemplate(data), _rotation(0) {
+Transform::Transform(ComponentData const*data) : ComponentTemplate(data), _rotation(0), _globalRotation(0), _dirty(true) {
 }
 
 bool Transform::init() {
-    _position = _data->getVector("position",{0,0});
-    _rotation = _data->getData<float>("rotation",0);
-    _scale = _data->getVector("scale",{1,1});
+    const Data& data = _data->get<Data>();
+    _position = data.position;
+    _rotation = data.rotation;
+    _scale = data.scale;
+    markDirty();
     return true;
 }
 
+void Transform::updateGlobal() const {
+    if (Transform* parent = getParent()) {
+        if (parent->_dirty) parent->updateGlobal();
+        _globalPosition = _position + parent->_globalPosition;
+        _globalScale = _scale * parent->_globalScale;
+        _globalRotation = _rotation + parent->_globalRotation;
+    }
+    else {
+        _globalPosition = _position;
+        _globalScale = _scale;
+        _globalRotation = _rotation;
+    }
+    _dirty = false;
+}
+
+void Transform::markDirty() {
+    if (_dirty) return;
+    _dirty = true;
+    for (Component* component : _entity->getComponents()) {
+        component->onTransformChanged();
+    }
+    for (Entity* child : _entity->getChildren()) {
+        if (Transform* transform = child->getComponent<Transform>()) {
+            transform->markDirty();
+        }
+    }
+}
+
 const Vector2& Transform::getPosition() const {
     return _position;
 }
 
 Vector2 Transform::getGlobalPosition() const {
-    if (Transform* parent = getParent()) {
-        return _position + parent->getGlobalPosition();
-    }
-    return _position;
+    if (_dirty) updateGlobal();
+    return _globalPosition;
 }
 
 void Transform::setPosition(const Vector2 &position) {
     _position = position;
+    markDirty();
 }
 
 void Transform::setPosition(const float x, const float y) {
     _position = Vector2(x, y);
+    markDirty();
 }
 
 void Transform::setPositionX(const float x) {
     _position.setX(x);
+    markDirty();
 }
 
 void Transform::setPositionY(const float y) {
     _position.setY(y);
+    markDirty();
 }
 
 void Transform::move(const Vector2 &movement) {
     _position += movement;
+    markDirty();
 }
 
 void Transform::move(const float movX, const float movY) {
     _position += Vector2(movX, movY);
+    markDirty();
 }
 
 void Transform::moveX(const float movY) {
     _position.setX(_position.getX() + movY);
+    markDirty();
 }
 
 void Transform::moveY(const float movX) {
     _position.setY(_position.getY() + movX);
+    markDirty();
 }
 
 const Vector2& Transform::getScale() const {
@@ -60,42 +96,48 @@ const Vector2& Transform::getScale() const {
 }
 
 Vector2 Transform::getGlobalScale() const {
-    if (Transform* parent = getParent()) {
-        return _scale * parent->getGlobalScale();
-    }
-    return _scale;
+    if (_dirty) updateGlobal();
+    return _globalScale;
 }
 
 void Transform::setScale(const Vector2 &scale) {
     _scale = scale;
+    markDirty();
 }
 
 void Transform::setScale(float x, float y) {
     _scale = Vector2(x, y);
+    markDirty();
 }
 
 void Transform::setScaleX(float x) {
     _scale.setX(x);
+    markDirty();
 }
 
 void Transform::setScaleY(float y) {
     _scale.setY(y);
+    markDirty();
 }
 
 void Transform::doScale(const Vector2 &scaleFactor) {
     _scale *= scaleFactor;
+    markDirty();
 }
 
 void Transform::doScale(const float scaleX, const float scaleY) {
     _scale *= Vector2(scaleX, scaleY);
+    markDirty();
 }
 
 void Transform::doScaleX(const float scaleX) {
     _scale.setX(_scale.getX() * scaleX);
+    markDirty();
 }
 
 void Transform::doScaleY(const float scaleY) {
     _scale.setX(_scale.getX() * scaleY);
+    markDirty();
 }
 
 const float& Transform::getRotation() const {
@@ -103,18 +145,18 @@ const float& Transform::getRotation() const {
 }
 
 float Transform::getGlobalRotation() const {
-    if (Transform* parent = getParent()) {
-        return _rotation + parent->getGlobalRotation();
-    }
-    return _rotation;
+    if (_dirty) updateGlobal();
+    return _globalRotation;
 }
 
 void Transform::setRotation(const float rotation) {
     _rotation = rotation;
+    markDirty();
 }
 
 void Transform::rotate(const float rotation) {
     _rotation += rotation;
+    markDirty();
 }
 
 Transform* Transform::getParent() const {
@@ -128,14 +170,14 @@ Transform* Transform::getParent() const {
 void Transform::RegisterToLua(sol::state& lua) {
     sol::usertype<Transform> type = lua.new_usertype<Transform>("Transform");
 
-    type["position"] = &Transform::_position;
+    type["position"] = sol::property(&Transform::getPosition, static_cast<void (Transform::*)(const Vector2&)>(&Transform::setPosition));
     type["getGlobalPosition"] = &Transform::getGlobalPosition;
     type["setPositionX"] = &Transform::setPositionX;
     type["setPositionY"] = &Transform::setPositionY;
     type["moveX"] = &Transform::moveX;
     type["moveY"] = &Transform::moveY;
 
-    type["scale"] = &Transform::_scale;
+    type["scale"] = sol::property(&Transform::getScale, static_cast<void (Transform::*)(const Vector2&)>(&Transform::setScale));
     type["getGlobalScale"] = &Transform::getGlobalScale;
     type["setScaleX"] = &Transform::setScaleX;
     type["setScaleY"] = &Transform::setScaleY;
@@ -149,3 +191,9 @@ void Transform::RegisterToLua(sol::state& lua) {
     type["getParent"] = &Transform::getParent;
     type["get"] = Transform::get;
 }
+
+void Transform::DeclareSchema(ComponentSchemaTemplate<Data>& schema) {
+    schema.field("position", &Data::position, Vector2(0, 0))
+        .field("rotation", &Data::rotation, 0)
+        .field("scale", &Data::scale, Vector2(1, 1));
+}
@@ -8,8 +8,19 @@ class ComponentClass(Transform) {
     Vector2 _position;
     Vector2 _scale;
     float _rotation;
+    mutable Vector2 _globalPosition;
+    mutable Vector2 _globalScale;
+    mutable float _globalRotation;
+    mutable bool _dirty;
+    void updateGlobal() const;
     public:
+    struct Data : ComponentFields {
+        Vector2 position;
+        float rotation;
+        Vector2 scale;
+    };
     Transform(ComponentData const*data);
+    static void DeclareSchema(ComponentSchemaTemplate<Data>& schema);
     bool init() override;
     const Vector2& getPosition() const;
     Vector2 getGlobalPosition() const;
@@ -36,6 +47,7 @@ class ComponentClass(Transform) {
     void setRotation(float rotation);
     void rotate(float rotation);
     Transform* getParent() const;
+    void markDirty();
 
     static void RegisterToLua(sol::state& lua);
 };
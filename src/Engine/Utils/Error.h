@@ -5,6 +5,7 @@
 class Error {
 public:
     static void ShowError(const std::string& title, const std::string& body);
+    static void LogWarning(const std::string& title, const std::string& body);
 };
 
 
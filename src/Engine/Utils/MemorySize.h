@@ -0,0 +1,58 @@
+#ifndef MEMORYSIZE_H_
+#define MEMORYSIZE_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+class MemorySize {
+public:
+	/// @~english
+	/// @brief Gets the memory a value owns outside of itself. Values that don't allocate own nothing.
+	/// @param value Value to measure.
+	/// @return Size in bytes of the owned memory, without counting \c sizeof(value) .
+	/// @~spanish
+	/// @brief Accede a la memoria que posee un valor fuera de sí mismo. Los valores que no reservan memoria no poseen nada.
+	/// @param value Valor a medir.
+	/// @return Tamaño en bytes de la memoria poseída, sin contar \c sizeof(value) .
+	template <typename T>
+	static size_t Of(T const& value) {
+		return 0;
+	}
+
+	static size_t Of(std::string const& value) {
+		auto data = reinterpret_cast<uintptr_t>(value.data());
+		auto object = reinterpret_cast<uintptr_t>(&value);
+		bool local = data >= object && data < object + sizeof(value);
+		return local ? 0 : value.capacity() + 1;
+	}
+
+	template <typename T>
+	static size_t Of(std::vector<T> const& value) {
+		size_t size = value.capacity() * sizeof(T);
+		for (T const& element : value)
+			size += Of(element);
+		return size;
+	}
+
+	template <typename T, size_t N>
+	static size_t Of(std::array<T, N> const& value) {
+		size_t size = 0;
+		for (T const& element : value)
+			size += Of(element);
+		return size;
+	}
+
+	template <typename T>
+	static size_t Of(std::unordered_set<T> const& value) {
+		size_t size = value.bucket_count() * sizeof(void*) + value.size() * (sizeof(T) + 2 * sizeof(void*));
+		for (T const& element : value)
+			size += Of(element);
+		return size;
+	}
+};
+
+#endif
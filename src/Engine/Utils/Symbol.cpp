@@ -0,0 +1,61 @@
+#include "Symbol.h"
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+#include <sol/state.hpp>
+
+Symbol::Entry const* Symbol::Intern(std::string_view string) {
+	static std::deque<Entry> entries = {{"", 0}};
+	static std::unordered_map<std::string_view, Entry const*> table = {{entries.front().string, &entries.front()}};
+	static std::mutex mutex;
+
+	std::lock_guard lock(mutex);
+	if (auto finder = table.find(string); finder != table.end()) {
+		return finder->second;
+	}
+	entries.push_back({std::string(string), static_cast<uint32_t>(entries.size())});
+	Entry const& entry = entries.back();
+	table.insert({entry.string, &entry});
+	return &entry;
+}
+
+Symbol::Symbol() {
+	static Entry const* empty = Intern({});
+	_entry = empty;
+}
+
+Symbol::Symbol(std::string_view string) :
+	_entry(Intern(string)) {
+}
+
+Symbol::Symbol(std::string const& string) :
+	_entry(Intern(string)) {
+}
+
+Symbol::Symbol(char const* string) :
+	_entry(Intern(string)) {
+}
+
+std::string const& Symbol::str() const {
+	return _entry->string;
+}
+
+uint32_t Symbol::getId() const {
+	return _entry->id;
+}
+
+bool Symbol::empty() const {
+	return _entry->id == 0;
+}
+
+bool Symbol::operator==(Symbol const& other) const {
+	return _entry == other._entry;
+}
+
+void Symbol::RegisterToLua(sol::state& lua) {
+	sol::usertype<Symbol> type = lua.new_usertype<Symbol>("Symbol",
+		sol::constructors<Symbol(), Symbol(std::string const&)>());
+	type["str"] = &Symbol::str;
+	type["empty"] = &Symbol::empty;
+	type[sol::meta_function::to_string] = &Symbol::str;
+}
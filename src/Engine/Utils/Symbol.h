@@ -0,0 +1,70 @@
+#ifndef SYMBOL_H
+#define SYMBOL_H
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <sol/forward.hpp>
+
+/// @~english
+/// @brief Interned string. Every \c Symbol built from the same text shares a single engine-wide entry, so copies, comparisons and hashing are pointer operations.
+/// @~spanish
+/// @brief Cadena internada. Todos los \c Symbol creados a partir del mismo texto comparten una única entrada en el motor, por lo que copiarlos, compararlos y calcular su hash son operaciones sobre punteros.
+class Symbol {
+private:
+	struct Entry {
+		std::string string;
+		uint32_t id;
+	};
+	Entry const* _entry;
+	friend struct std::hash<Symbol>;
+
+	/// @~english
+	/// @brief Returns the entry of the given text, adding it to the table if it wasn't interned yet.
+	/// @~spanish
+	/// @brief Devuelve la entrada del texto dado, añadiéndola a la tabla si no estaba internada.
+	static Entry const* Intern(std::string_view string);
+public:
+	/// @~english
+	/// @brief Creates the empty \c Symbol .
+	/// @~spanish
+	/// @brief Crea el \c Symbol vacío.
+	Symbol();
+
+	/// @~english
+	/// @brief Creates the \c Symbol of the given text.
+	/// @param string Text to intern.
+	/// @~spanish
+	/// @brief Crea el \c Symbol del texto dado.
+	/// @param string Texto a internar.
+	Symbol(std::string_view string);
+	Symbol(std::string const& string);
+	Symbol(char const* string);
+
+	/// @~english
+	/// @brief Interned text of the \c Symbol .
+	/// @~spanish
+	/// @brief Texto internado del \c Symbol .
+	std::string const& str() const;
+
+	/// @~english
+	/// @brief Dense identifier of the \c Symbol , assigned in order of interning. The empty \c Symbol is \c 0 .
+	/// @~spanish
+	/// @brief Identificador denso del \c Symbol , asignado en orden de internado. El \c Symbol vacío es \c 0 .
+	uint32_t getId() const;
+
+	bool empty() const;
+
+	bool operator==(Symbol const& other) const;
+
+	static void RegisterToLua(sol::state& lua);
+};
+
+template <>
+struct std::hash<Symbol> {
+	std::size_t operator()(Symbol const& symbol) const noexcept {
+		return std::hash<void const*>()(symbol._entry);
+	}
+};
+
+#endif //SYMBOL_H
@@ -1,4 +1,5 @@
 #include "Utils/Time.h"
 
 float Time::_deltaTime = 0.0;
-float Time::_time = 0.0;
\ No newline at end of file
+float Time::_time = 0.0;
+float Time::_fixedAlpha = 0.0;
\ No newline at end of file
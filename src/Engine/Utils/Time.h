@@ -13,6 +13,7 @@ private:
 
 	static float _deltaTime;
 	static float _time;
+	static float _fixedAlpha;
 public:
 	/// @~english
 	/// @brief Time in seconds passed since last update
@@ -31,6 +32,18 @@ public:
 	/// @~spanish
 	/// @brief Tiempo en segundos cada el que se evalúan las operaciones físicas
 	static constexpr float fixedDeltaTime = 0.02;
+
+	/// @~english
+	/// @brief Fraction, between \c 0 and \c 1, of a fixed step elapsed since the last physics update. Renderers can use it to interpolate between fixed states
+	/// @~spanish
+	/// @brief Fracción, entre \c 0 y \c 1, de paso fijo transcurrida desde la última actualización física. Los renderizadores pueden usarla para interpolar entre estados fijos
+	static constexpr float const& fixedAlpha = _fixedAlpha;
+
+	/// @~english
+	/// @brief Maximum number of physics updates run per frame. Any time left over after that is discarded
+	/// @~spanish
+	/// @brief Número máximo de actualizaciones físicas por fotograma. El tiempo sobrante a partir de ahí se descarta
+	static constexpr int maxFixedSteps = 5;
 };
 
 #endif
\ No newline at end of file
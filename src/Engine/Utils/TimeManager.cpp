@@ -1,5 +1,6 @@
 #include "TimeManager.h"
 #include "Utils/Time.h"
+#include <cmath>
 
 void TimeManager::init() {
 	_previous = std::chrono::system_clock::now();
@@ -10,4 +11,19 @@ void TimeManager::update() {
 	Time::_deltaTime = std::chrono::duration<float>(current - _previous).count();;
 	Time::_time += Time::_deltaTime;
 	_previous = current;
+	_accumulator += Time::_deltaTime;
+	_fixedSteps = 0;
+}
+
+bool TimeManager::fixedStep() {
+	if (_fixedSteps >= Time::maxFixedSteps) {
+		_accumulator = std::fmod(_accumulator, Time::fixedDeltaTime);
+	}
+	if (_accumulator < Time::fixedDeltaTime) {
+		Time::_fixedAlpha = _accumulator / Time::fixedDeltaTime;
+		return false;
+	}
+	_accumulator -= Time::fixedDeltaTime;
+	++_fixedSteps;
+	return true;
 }
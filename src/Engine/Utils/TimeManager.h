@@ -10,6 +10,8 @@
 class TimeManager {
 private:
 	std::chrono::system_clock::time_point _previous;
+	float _accumulator = 0.0f;
+	int _fixedSteps = 0;
 
 public:
 	/// @~english
@@ -22,6 +24,15 @@ public:
 	/// @~spanish
 	/// @brief Actualiza el conteo del tiempo del programa y el tiempo pasado desde la última actualización
 	void update();
+	/// @~english
+	/// @brief Consumes one fixed step from the time accumulated since the last updates
+	/// @remark Meant to be called in a loop after \c update. It stops after \c Time::maxFixedSteps steps per frame and then updates \c Time::fixedAlpha
+	/// @return \c true if a physics update must be run. \c false once there's no more accumulated time for this frame
+	/// @~spanish
+	/// @brief Consume un paso fijo del tiempo acumulado desde las anteriores actualizaciones
+	/// @remark Pensado para llamarse en bucle tras \c update. Se detiene tras \c Time::maxFixedSteps pasos por fotograma y después actualiza \c Time::fixedAlpha
+	/// @return \c true si hay que ejecutar una actualización física. \c false cuando no queda tiempo acumulado en este fotograma
+	bool fixedStep();
 };
 
 #endif
@@ -0,0 +1,43 @@
+#include "UTF8.h"
+
+bool UTF8::Decode(std::string_view text, size_t& index, uint32_t& codepoint) {
+	if (index >= text.size())
+		return false;
+	const auto lead = static_cast<unsigned char>(text[index]);
+	size_t length;
+	if (lead < 0x80) {
+		codepoint = lead;
+		++index;
+		return true;
+	}
+	if ((lead & 0xE0) == 0xC0) {
+		length = 2;
+		codepoint = lead & 0x1F;
+	}
+	else if ((lead & 0xF0) == 0xE0) {
+		length = 3;
+		codepoint = lead & 0x0F;
+	}
+	else if ((lead & 0xF8) == 0xF0) {
+		length = 4;
+		codepoint = lead & 0x07;
+	}
+	else {
+		codepoint = 0xFFFD;
+		++index;
+		return true;
+	}
+	for (size_t i = 1; i < length; ++i) {
+		if (index + i >= text.size())
+			return false;
+		const auto next = static_cast<unsigned char>(text[index + i]);
+		if ((next & 0xC0) != 0x80) {
+			codepoint = 0xFFFD;
+			index += i;
+			return true;
+		}
+		codepoint = codepoint << 6 | (next & 0x3F);
+	}
+	index += length;
+	return true;
+}
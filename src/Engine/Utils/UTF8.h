@@ -0,0 +1,26 @@
+#ifndef UTF8_H_
+#define UTF8_H_
+
+#include <cstdint>
+#include <string_view>
+
+class UTF8 {
+public:
+	/// @~english
+	/// @brief Decodes the UTF-8 code point that starts at a position of a text and advances the position past it.
+	/// @remarks Invalid bytes are decoded as U+FFFD. A sequence cut at the end of the text isn't consumed.
+	/// @param text Text to decode.
+	/// @param index Position of the first byte of the code point. It's updated to the position of the next one.
+	/// @param codepoint Decoded code point.
+	/// @return \c true if a code point was decoded. \c false at the end of the text or before an incomplete sequence.
+	/// @~spanish
+	/// @brief Decodifica el code point UTF-8 que empieza en una posición de un texto y avanza la posición tras él.
+	/// @remarks Los bytes inválidos se decodifican como U+FFFD. Una secuencia cortada al final del texto no se consume.
+	/// @param text Texto a decodificar.
+	/// @param index Posición del primer byte del code point. Se actualiza a la posición del siguiente.
+	/// @param codepoint Code point decodificado.
+	/// @return \c true si se decodificó un code point. \c false al final del texto o ante una secuencia incompleta.
+	static bool Decode(std::string_view text, size_t& index, uint32_t& codepoint);
+};
+
+#endif